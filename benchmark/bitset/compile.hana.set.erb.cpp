@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/difference.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/union.hpp>
+
+
+int main() {
+    // Two overlapping sets of keys in [0, 2 * input_size)
+    constexpr auto xs = boost::hana::make_set(
+        <%= (0...input_size).map { |n| "boost::hana::int_c<#{2 * n}>" }.join(', ') %>
+    );
+    constexpr auto ys = boost::hana::make_set(
+        <%= (0...input_size).map { |n| "boost::hana::int_c<#{n}>" }.join(', ') %>
+    );
+
+    constexpr auto u = boost::hana::union_(xs, ys);
+    constexpr auto i = boost::hana::intersection(xs, ys);
+    constexpr auto d = boost::hana::difference(xs, ys);
+    constexpr auto c = boost::hana::contains(u, boost::hana::int_c<<%= input_size %>>);
+    (void)u; (void)i; (void)d; (void)c;
+}
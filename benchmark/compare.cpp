@@ -0,0 +1,389 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+//
+// Compares benchmark results against a baseline.
+//
+// Usage: compare <baseline directory> <tolerance in percent> <results...>
+//        compare --update <baseline directory> <results...>
+//
+// Each result is a JSON file generated by a benchmark target, and it is
+// compared to the file with the same name in the baseline directory. Results
+// that have not been generated, or that have no baseline, are skipped. For
+// each series (matched by name) and each input size present in both files,
+// the measurement is flagged as a regression if it exceeds the baseline by
+// more than the tolerance, and by more than the noise floor of its aspect
+// (compilation time, peak memory usage, executable size, ...).
+//
+// The complexity class of each series is also estimated, by fitting the
+// measurements to `a + b * g(n)` for a few growth functions `g`, and a
+// series whose complexity class got worse is flagged as a regression too.
+//
+// The program returns a non-zero exit status if any regression is found.
+// With `--update`, the results are copied to the baseline directory instead.
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+//////////////////////////////////////////////////////////////////////////////
+// A minimal JSON reader, sufficient for the datasets of the benchmarks.
+//////////////////////////////////////////////////////////////////////////////
+struct json {
+    enum kind_t { null, boolean, number, string, array, object } kind = null;
+    double num = 0;
+    std::string str;
+    std::vector<json> elements;
+    std::vector<std::pair<std::string, json>> members;
+
+    json const* find(std::string const& key) const {
+        for (auto const& member : members)
+            if (member.first == key)
+                return &member.second;
+        return nullptr;
+    }
+};
+
+class json_parser {
+    std::string const& text_;
+    std::size_t pos_ = 0;
+
+    [[noreturn]] void fail(std::string const& what) const {
+        std::ostringstream message;
+        message << what << " at offset " << pos_;
+        throw std::runtime_error(message.str());
+    }
+
+    void skip_spaces() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_])))
+            ++pos_;
+    }
+
+    bool consume(char c) {
+        skip_spaces();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c))
+            fail(std::string("expected '") + c + "'");
+    }
+
+    std::string parse_string() {
+        expect('"');
+        std::string result;
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c == '\\' && pos_ < text_.size()) {
+                c = text_[pos_++];
+                switch (c) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u': pos_ += 4; c = '?'; break;
+                    default: break;
+                }
+            }
+            result += c;
+        }
+        expect('"');
+        return result;
+    }
+
+public:
+    explicit json_parser(std::string const& text) : text_(text) { }
+
+    json parse() {
+        json value;
+        skip_spaces();
+        if (pos_ >= text_.size())
+            fail("unexpected end of input");
+
+        char c = text_[pos_];
+        if (c == '{') {
+            value.kind = json::object;
+            ++pos_;
+            if (!consume('}')) {
+                do {
+                    skip_spaces();
+                    std::string key = parse_string();
+                    expect(':');
+                    value.members.emplace_back(std::move(key), parse());
+                } while (consume(','));
+                expect('}');
+            }
+        } else if (c == '[') {
+            value.kind = json::array;
+            ++pos_;
+            if (!consume(']')) {
+                do {
+                    value.elements.push_back(parse());
+                } while (consume(','));
+                expect(']');
+            }
+        } else if (c == '"') {
+            value.kind = json::string;
+            value.str = parse_string();
+        } else if (text_.compare(pos_, 4, "true") == 0 || text_.compare(pos_, 5, "false") == 0) {
+            value.kind = json::boolean;
+            value.num = text_[pos_] == 't';
+            pos_ += text_[pos_] == 't' ? 4 : 5;
+        } else if (text_.compare(pos_, 4, "null") == 0) {
+            pos_ += 4;
+        } else {
+            value.kind = json::number;
+            char const* begin = text_.c_str() + pos_;
+            char* end = nullptr;
+            value.num = std::strtod(begin, &end);
+            if (end == begin)
+                fail("unexpected character");
+            pos_ += static_cast<std::size_t>(end - begin);
+        }
+        return value;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Datasets
+//////////////////////////////////////////////////////////////////////////////
+// What a series measures, which determines its unit and its noise floor,
+// i.e. the smallest absolute difference that is considered significant.
+struct aspect {
+    char const* name;
+    char const* unit;
+    double noise_floor;
+};
+
+aspect const compilation_time{"compilation time", "s", 0.1};
+aspect const execution_time{"execution time", "s", 0.0};
+aspect const executable_size{"executable size", "kb", 5};
+aspect const peak_memory{"peak memory usage", "MB", 10};
+aspect const instantiations{"instantiations", "", 0};
+
+struct series {
+    std::string name;
+    aspect const* what;
+    std::map<double, double> points; // input size -> measurement
+};
+
+// The aspect of a series is given by its `aspect` member if it has one, and
+// otherwise by the kind of benchmark it comes from (`compile`, `execute` or
+// `bloat`), which is the first part of the file name after the directory.
+aspect const* aspect_of(std::string const& file, json const& series) {
+    if (json const* a = series.find("aspect")) {
+        if (a->str == "peak_memory") return &peak_memory;
+        if (a->str == "instantiations") return &instantiations;
+    }
+    std::string base = file.substr(file.find_last_of("/\\") + 1);
+    if (base.find(".bloat") != std::string::npos) return &executable_size;
+    if (base.find(".execute") != std::string::npos) return &execution_time;
+    return &compilation_time;
+}
+
+bool read_dataset(std::string const& file, std::vector<series>& result) {
+    std::ifstream in(file);
+    if (!in)
+        return false;
+    std::string text{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    if (text.find_first_not_of(" \t\r\n") == std::string::npos)
+        return false;
+
+    json dataset = json_parser(text).parse();
+    json const* all = dataset.find("series");
+    if (all == nullptr)
+        return true;
+    for (json const& s : all->elements) {
+        json const* name = s.find("name");
+        json const* data = s.find("data");
+        if (name == nullptr || data == nullptr)
+            continue;
+        series current{name->str, aspect_of(file, s), {}};
+        for (json const& point : data->elements)
+            if (point.elements.size() == 2)
+                current.points[point.elements[0].num] = point.elements[1].num;
+        result.push_back(std::move(current));
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Complexity classes
+//////////////////////////////////////////////////////////////////////////////
+struct complexity {
+    char const* name;
+    double (*growth)(double);
+};
+
+complexity const classes[] = {
+    {"O(1)",       [](double)   { return 0.0; }},
+    {"O(log n)",   [](double n) { return std::log(n); }},
+    {"O(n)",       [](double n) { return n; }},
+    {"O(n log n)", [](double n) { return n * std::log(n); }},
+    {"O(n^2)",     [](double n) { return n * n; }},
+    {"O(n^3)",     [](double n) { return n * n * n; }},
+};
+
+// Returns the index in `classes` of the complexity class fitting the points
+// best, or -1 if there are not enough points to tell. A series that grows by
+// less than 10% over the whole range of input sizes is considered constant.
+int complexity_of(std::map<double, double> const& points) {
+    std::vector<std::pair<double, double>> xs;
+    for (auto const& p : points)
+        if (p.first >= 1)
+            xs.push_back(p);
+    if (xs.size() < 4)
+        return -1;
+
+    double lowest = xs.front().second, highest = xs.front().second;
+    for (auto const& p : xs) {
+        lowest = std::min(lowest, p.second);
+        highest = std::max(highest, p.second);
+    }
+    if (highest <= 0 || highest - lowest <= 0.1 * highest)
+        return 0;
+
+    int best = 0;
+    double best_error = -1;
+    for (int c = 1; c != static_cast<int>(sizeof(classes) / sizeof(classes[0])); ++c) {
+        // Least squares fit of `y = a + b * g(n)`
+        double sg = 0, sy = 0, sgg = 0, sgy = 0, k = static_cast<double>(xs.size());
+        for (auto const& p : xs) {
+            double g = classes[c].growth(p.first);
+            sg += g; sy += p.second; sgg += g * g; sgy += g * p.second;
+        }
+        double denominator = k * sgg - sg * sg;
+        if (denominator == 0)
+            continue;
+        double b = (k * sgy - sg * sy) / denominator;
+        double a = (sy - b * sg) / k;
+        if (b <= 0)
+            continue;
+
+        double error = 0;
+        for (auto const& p : xs) {
+            double residual = p.second - (a + b * classes[c].growth(p.first));
+            error += residual * residual;
+        }
+        if (best_error < 0 || error < best_error) {
+            best = c;
+            best_error = error;
+        }
+    }
+    return best;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Driver
+//////////////////////////////////////////////////////////////////////////////
+std::string base_name(std::string const& path)
+{ return path.substr(path.find_last_of("/\\") + 1); }
+
+int update(std::string const& baseline, std::vector<std::string> const& results) {
+    int updated = 0;
+    for (std::string const& result : results) {
+        std::ifstream in(result, std::ios::binary);
+        if (!in || in.peek() == std::ifstream::traits_type::eof())
+            continue;
+        std::ofstream out(baseline + "/" + base_name(result), std::ios::binary);
+        if (!out) {
+            std::cerr << "could not write to " << baseline << "/" << base_name(result) << "\n";
+            return EXIT_FAILURE;
+        }
+        out << in.rdbuf();
+        ++updated;
+    }
+    std::cout << "Updated " << updated << " baseline(s) in " << baseline << "\n";
+    return EXIT_SUCCESS;
+}
+
+int compare(std::string const& baseline, double tolerance,
+            std::vector<std::string> const& results)
+{
+    int compared = 0, regressions = 0;
+    for (std::string const& result : results) {
+        std::vector<series> current, previous;
+        try {
+            if (!read_dataset(result, current) ||
+                !read_dataset(baseline + "/" + base_name(result), previous))
+                continue;
+        } catch (std::exception const& e) {
+            std::cerr << result << ": " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+        ++compared;
+
+        for (series const& now : current) {
+            auto before = std::find_if(previous.begin(), previous.end(),
+                [&](series const& s) { return s.name == now.name; });
+            if (before == previous.end())
+                continue;
+
+            std::ostringstream report;
+            for (auto const& point : now.points) {
+                auto old = before->points.find(point.first);
+                if (old == before->points.end())
+                    continue;
+                double delta = point.second - old->second;
+                if (delta > now.what->noise_floor &&
+                    point.second > old->second * (1 + tolerance / 100)) {
+                    report << "    n = " << point.first << ": " << now.what->name
+                           << " went from " << old->second << now.what->unit
+                           << " to " << point.second << now.what->unit;
+                    if (old->second > 0)
+                        report << " (+" << std::lround(100 * delta / old->second) << "%)";
+                    report << "\n";
+                    ++regressions;
+                }
+            }
+
+            int was = complexity_of(before->points), is = complexity_of(now.points);
+            if (was >= 0 && is > was) {
+                report << "    " << now.what->name << " went from "
+                       << classes[was].name << " to " << classes[is].name << "\n";
+                ++regressions;
+            }
+
+            std::string text = report.str();
+            if (!text.empty())
+                std::cout << base_name(result) << ": " << now.name << "\n" << text;
+        }
+    }
+
+    std::cout << "Compared " << compared << " benchmark(s) against " << baseline
+              << ": " << regressions << " regression(s) beyond " << tolerance << "%\n";
+    return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && std::string(argv[1]) == "--update")
+        return update(argv[2], std::vector<std::string>(argv + 3, argv + argc));
+
+    if (argc < 3) {
+        std::fprintf(stderr,
+            "usage: %s <baseline directory> <tolerance in percent> <results...>\n"
+            "       %s --update <baseline directory> <results...>\n", argv[0], argv[0]);
+        return EXIT_FAILURE;
+    }
+    return compare(argv[1], std::atof(argv[2]),
+                   std::vector<std::string>(argv + 3, argv + argc));
+}
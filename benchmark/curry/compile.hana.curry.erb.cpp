@@ -0,0 +1,17 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/functional/curry.hpp>
+
+
+struct f {
+    template <typename ...X>
+    constexpr int operator()(X ...) const { return sizeof...(X); }
+};
+
+int main() {
+    constexpr int result = boost::hana::curry<<%= input_size %>>(f{})
+        <%= (1..input_size).map { |n| "(#{n})" }.join %>;
+    (void)result;
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/functional/curry.hpp>
+#include <boost/hana/functional/partial.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+struct sum {
+    template <typename ...X>
+    long long operator()(X ...x) const {
+        long long result = 0;
+        using expand = int[];
+        (void)expand{0, ((void)(result += x), 0)...};
+        return result;
+    }
+};
+
+int main() {
+    // The arguments are stored flat, so the closure is no bigger than the
+    // arguments it holds.
+    auto almost = boost::hana::curry<<%= input_size + 1 %>>(sum{})
+        <%= (1..input_size).map { |n| "(#{n})" }.join %>;
+    static_assert(sizeof(almost) == sizeof(boost::hana::partial(sum{}
+        <%= (1..input_size).map { |n| ", #{n}" }.join %>)), "");
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += boost::hana::curry<<%= input_size %>>(sum{})
+                <%= (1..input_size).map { |n| "(std::rand() + #{n})" }.join %>;
+            result += almost(iteration);
+        }
+        (void)result;
+    });
+}
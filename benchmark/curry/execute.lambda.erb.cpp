@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main() {
+    auto almost = <%= (1..input_size).map { |n| "[=](auto x#{n}) { return " }.join %>
+        [=](auto last) { return <%= (1..input_size).map { |n| "x#{n} + " }.join %>last; }
+    <%= "; }" * input_size %>
+        <%= (1..input_size).map { |n| "(#{n})" }.join %>;
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += <%= (1..input_size).map { |n| "[=](long long x#{n}) { return " }.join %>
+                <%= (1..input_size).map { |n| "x#{n}" }.join(' + ') %>
+            <%= "; }" * input_size %>
+                <%= (1..input_size).map { |n| "(std::rand() + #{n})" }.join %>;
+            result += almost(iteration);
+        }
+        return result;
+    });
+}
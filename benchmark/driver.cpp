@@ -0,0 +1,1621 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+//
+// Native benchmark driver, used when Ruby is not available.
+//
+// Usage: driver <cmake> <binary dir> <measure target> <measure file>
+//               <measure executable> <dataset template> <dataset>
+//        driver --launch <compiler id> <command> [args...]
+//        driver --render <template> <input size>
+//
+// This program does what `measure.rb` does, without requiring Ruby. In the
+// first form, it evaluates the `.erb.json` dataset template (after it was
+// configured by CMake), and writes the resulting dataset. The `measure`,
+// `time_compilation`, `time_execution`, `peak_memory` and
+// `count_instantiations` functions called by the dataset evaluate a `.erb.cpp`
+// template for each input size, write it to the measure file, and build the
+// measure target (or run it) with CMake to get the statistics.
+//
+// In the second form, this program is the compiler launcher of the measure
+// target. It runs the compiler, and then prints the compilation time, the
+// peak memory usage and, if the `BOOST_HANA_COUNT_INSTANTIATIONS` environment
+// variable is set, the number of template instantiations. The exit status of
+// the compiler is returned unchanged.
+//
+// The third form prints a `.erb.cpp` template evaluated for the given input
+// size, which is useful to debug a template.
+//
+// Templates are evaluated by an interpreter for the subset of Ruby used by
+// the benchmarks: literals, arrays, ranges, `#{}` interpolation, arithmetic
+// and comparison operators, local variables, `if`, `def`, blocks, the usual
+// methods of integers, strings and arrays (`times`, `map`, `join`, `step`,
+// `inject`, ...), and the helpers defined in `measure.in.rb`. Like Tilt, the
+// templates are evaluated in ERB's `<>` trim mode.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#   include <process.h>
+#   define popen _popen
+#   define pclose _pclose
+#else
+#   include <sys/resource.h>
+#   include <sys/time.h>
+#   include <sys/types.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Values
+//////////////////////////////////////////////////////////////////////////////
+struct value;
+using array_ptr = std::shared_ptr<std::vector<value>>;
+
+struct value {
+    enum kind_t { nil, boolean, integer, floating, string, symbol, array } kind = nil;
+    long long i = 0; // booleans and integers
+    double f = 0;
+    std::string s;   // strings and symbols
+    array_ptr a;     // arrays have reference semantics, like in Ruby
+
+    static value make_bool(bool b) { value v; v.kind = boolean; v.i = b; return v; }
+    static value make_int(long long i) { value v; v.kind = integer; v.i = i; return v; }
+    static value make_float(double f) { value v; v.kind = floating; v.f = f; return v; }
+    static value make_string(std::string s) { value v; v.kind = string; v.s = std::move(s); return v; }
+    static value make_symbol(std::string s) { value v; v.kind = symbol; v.s = std::move(s); return v; }
+    static value make_array(std::vector<value> xs = {}) {
+        value v;
+        v.kind = array;
+        v.a = std::make_shared<std::vector<value>>(std::move(xs));
+        return v;
+    }
+
+    bool truthy() const { return kind != nil && !(kind == boolean && i == 0); }
+    bool numeric() const { return kind == integer || kind == floating; }
+    double as_double() const { return kind == integer ? static_cast<double>(i) : f; }
+};
+
+std::string inspect(value const& v);
+
+// Formats a floating point number with the shortest representation that
+// reads back to the same number, like Ruby.
+std::string format_float(double f) {
+    char buffer[32];
+    for (int precision = 1; precision <= 17; ++precision) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, f);
+        if (std::strtod(buffer, nullptr) == f)
+            break;
+    }
+    std::string result = buffer;
+    if (result.find_first_not_of("-0123456789") == std::string::npos)
+        result += ".0";
+    return result;
+}
+
+std::string to_s(value const& v) {
+    switch (v.kind) {
+        case value::nil: return "";
+        case value::boolean: return v.i ? "true" : "false";
+        case value::integer: return std::to_string(v.i);
+        case value::floating: return format_float(v.f);
+        case value::string: case value::symbol: return v.s;
+        case value::array: return inspect(v);
+    }
+    return "";
+}
+
+std::string inspect(value const& v) {
+    switch (v.kind) {
+        case value::nil: return "nil";
+        case value::symbol: return ":" + v.s;
+        case value::string: {
+            std::string result = "\"";
+            for (char c : v.s) {
+                if (c == '"' || c == '\\') result += '\\';
+                if (c == '\n') { result += "\\n"; continue; }
+                result += c;
+            }
+            return result + "\"";
+        }
+        case value::array: {
+            std::string result = "[";
+            for (std::size_t k = 0; k != v.a->size(); ++k)
+                result += (k ? ", " : "") + inspect((*v.a)[k]);
+            return result + "]";
+        }
+        default: return to_s(v);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Lexer
+//
+// Templates are turned into a single stream of tokens, in which the text
+// outside of the `<% %>` tags is a `text` token, `<%=` is an `output` token,
+// and `%>` is a newline.
+//////////////////////////////////////////////////////////////////////////////
+struct token {
+    enum kind_t { end, newline, text, output, integer, floating, string, symbol, identifier, punct } kind;
+    std::string str;          // text, string contents, symbol, identifier or punctuation
+    bool interpolated = false; // for strings with double quotes
+    long long i = 0;
+    double f = 0;
+    int line = 0;
+};
+
+class lexer {
+    std::string const& src_;
+    std::size_t pos_ = 0;
+    int line_ = 1;
+    std::vector<char> nesting_;
+    std::vector<token> tokens_;
+
+    [[noreturn]] void fail(std::string const& what) const {
+        throw std::runtime_error("line " + std::to_string(line_) + ": " + what);
+    }
+
+    void push(token::kind_t kind, std::string str = "") {
+        token t;
+        t.kind = kind;
+        t.str = std::move(str);
+        t.line = line_;
+        tokens_.push_back(std::move(t));
+    }
+
+    bool starts_with(char const* s) const
+    { return src_.compare(pos_, std::strlen(s), s) == 0; }
+
+    // Whether an expression can't end with the last token, in which case a
+    // newline following it does not end the statement.
+    bool continues_expression() const {
+        if (tokens_.empty() || tokens_.back().kind != token::punct)
+            return false;
+        static char const* const continuations[] = {
+            "+", "-", "*", "/", "%", "==", "!=", "<", ">", "<=", ">=", "&&", "||",
+            ",", ".", "=", "?", ":", "..", "..."
+        };
+        for (char const* c : continuations)
+            if (tokens_.back().str == c)
+                return true;
+        return false;
+    }
+
+    void newline() {
+        ++line_;
+        ++pos_;
+        bool in_parens = !nesting_.empty() && nesting_.back() != '{';
+        if (!in_parens && !continues_expression() &&
+            !tokens_.empty() && tokens_.back().kind != token::newline)
+            push(token::newline);
+    }
+
+    void lex_string(char quote) {
+        token t;
+        t.kind = token::string;
+        t.interpolated = quote == '"';
+        t.line = line_;
+        ++pos_;
+        while (pos_ < src_.size() && src_[pos_] != quote) {
+            char c = src_[pos_++];
+            if (c == '\n')
+                ++line_;
+            if (c == '\\' && pos_ < src_.size()) {
+                char escaped = src_[pos_++];
+                if (quote == '\'') {
+                    if (escaped != '\'' && escaped != '\\')
+                        t.str += '\\';
+                    t.str += escaped;
+                } else {
+                    // Escapes are resolved when the interpolation is parsed
+                    t.str += '\\';
+                    t.str += escaped;
+                }
+                continue;
+            }
+            t.str += c;
+        }
+        if (pos_ == src_.size())
+            fail("unterminated string");
+        ++pos_;
+        tokens_.push_back(std::move(t));
+    }
+
+    void lex_number() {
+        std::size_t start = pos_;
+        while (pos_ < src_.size() && (std::isdigit(static_cast<unsigned char>(src_[pos_])) || src_[pos_] == '_'))
+            ++pos_;
+        bool is_float = pos_ + 1 < src_.size() && src_[pos_] == '.' &&
+                        std::isdigit(static_cast<unsigned char>(src_[pos_ + 1]));
+        if (is_float) {
+            ++pos_;
+            while (pos_ < src_.size() && std::isdigit(static_cast<unsigned char>(src_[pos_])))
+                ++pos_;
+        }
+        std::string digits = src_.substr(start, pos_ - start);
+        digits.erase(std::remove(digits.begin(), digits.end(), '_'), digits.end());
+        token t;
+        t.line = line_;
+        if (is_float) {
+            t.kind = token::floating;
+            t.f = std::strtod(digits.c_str(), nullptr);
+        } else {
+            t.kind = token::integer;
+            t.i = std::strtoll(digits.c_str(), nullptr, 10);
+        }
+        tokens_.push_back(std::move(t));
+    }
+
+    static bool is_identifier_char(char c)
+    { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+    // Lexes code until the end of the input, or until `%>` in a template.
+    void lex_code(bool in_template) {
+        while (pos_ < src_.size()) {
+            char c = src_[pos_];
+            if (in_template && starts_with("%>"))
+                return;
+            else if (c == ' ' || c == '\t' || c == '\r')
+                ++pos_;
+            else if (c == '\\' && pos_ + 1 < src_.size() && src_[pos_ + 1] == '\n')
+                pos_ += 2, ++line_;
+            else if (c == '\n')
+                newline();
+            else if (c == '#') {
+                while (pos_ < src_.size() && src_[pos_] != '\n' && !(in_template && starts_with("%>")))
+                    ++pos_;
+            }
+            else if (std::isdigit(static_cast<unsigned char>(c)))
+                lex_number();
+            else if (is_identifier_char(c)) {
+                std::size_t start = pos_;
+                while (pos_ < src_.size() && is_identifier_char(src_[pos_]))
+                    ++pos_;
+                // Predicate methods like `even?`
+                if (pos_ < src_.size() && (src_[pos_] == '?' || src_[pos_] == '!') &&
+                    (pos_ + 1 == src_.size() || src_[pos_ + 1] != '='))
+                    ++pos_;
+                push(token::identifier, src_.substr(start, pos_ - start));
+            }
+            else if (c == '\'' || c == '"')
+                lex_string(c);
+            else if (c == ':' && pos_ + 1 < src_.size() &&
+                     (is_identifier_char(src_[pos_ + 1]) || std::strchr("+-*/", src_[pos_ + 1]))) {
+                std::size_t start = ++pos_;
+                if (is_identifier_char(src_[pos_])) {
+                    while (pos_ < src_.size() && is_identifier_char(src_[pos_]))
+                        ++pos_;
+                } else {
+                    ++pos_;
+                }
+                push(token::symbol, src_.substr(start, pos_ - start));
+            }
+            else {
+                static char const* const puncts[] = {
+                    "...", "..", "==", "!=", "<=", ">=", "&&", "||",
+                    "+", "-", "*", "/", "%", "<", ">", "!", "=", "?", ":", ",", ".",
+                    "(", ")", "[", "]", "{", "}", "|", ";"
+                };
+                char const* match = nullptr;
+                for (char const* p : puncts)
+                    if (starts_with(p)) { match = p; break; }
+                if (match == nullptr)
+                    fail(std::string("unexpected character '") + c + "'");
+                pos_ += std::strlen(match);
+                if (*match == '(' || *match == '[' || *match == '{')
+                    nesting_.push_back(*match);
+                else if ((*match == ')' || *match == ']' || *match == '}') && !nesting_.empty())
+                    nesting_.pop_back();
+                push(*match == ';' ? token::newline : token::punct, match);
+            }
+        }
+    }
+
+public:
+    explicit lexer(std::string const& src) : src_(src) { }
+
+    std::vector<token> code() {
+        lex_code(false);
+        push(token::end);
+        return std::move(tokens_);
+    }
+
+    std::vector<token> erb() {
+        while (pos_ < src_.size()) {
+            std::size_t tag = src_.find("<%", pos_);
+            std::string text = src_.substr(pos_, tag == std::string::npos ? std::string::npos : tag - pos_);
+            line_ += static_cast<int>(std::count(text.begin(), text.end(), '\n'));
+            if (tag != std::string::npos && src_.compare(tag, 3, "<%%") == 0) {
+                text += "<%";
+                pos_ = tag + 3;
+                if (!tokens_.empty() && tokens_.back().kind == token::text)
+                    tokens_.back().str += text;
+                else
+                    push(token::text, text);
+                continue;
+            }
+            if (!text.empty()) {
+                if (!tokens_.empty() && tokens_.back().kind == token::text)
+                    tokens_.back().str += text;
+                else
+                    push(token::text, text);
+            }
+            if (tag == std::string::npos)
+                break;
+
+            pos_ = tag + 2;
+            if (starts_with("=")) {
+                ++pos_;
+                push(token::output);
+            } else if (starts_with("#")) {
+                std::size_t close = src_.find("%>", pos_);
+                if (close == std::string::npos)
+                    fail("unterminated comment");
+                line_ += static_cast<int>(std::count(src_.begin() + pos_, src_.begin() + close, '\n'));
+                pos_ = close;
+            }
+            nesting_.clear();
+            lex_code(true);
+            if (!starts_with("%>"))
+                fail("unterminated '<%' tag");
+            push(token::newline);
+            pos_ += 2;
+
+            // In the `<>` trim mode, the newline following a tag is removed
+            // when the line it ends starts with a tag.
+            if (pos_ < src_.size() && src_[pos_] == '\n') {
+                std::size_t line_start = src_.rfind('\n', pos_ - 1);
+                line_start = line_start == std::string::npos ? 0 : line_start + 1;
+                if (src_.compare(line_start, 2, "<%") == 0 && src_.compare(line_start, 3, "<%%") != 0) {
+                    ++pos_;
+                    ++line_;
+                }
+            }
+        }
+        push(token::end);
+        return std::move(tokens_);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Parser
+//////////////////////////////////////////////////////////////////////////////
+struct node;
+using node_ptr = std::shared_ptr<node const>;
+
+struct block {
+    std::vector<std::string> params;
+    node_ptr body;
+};
+
+struct node {
+    enum kind_t {
+        literal, text, output, interpolation, array, identifier, assign, method, index,
+        unary, binary, logical_and, logical_or, conditional, sequence, def, range
+    } kind;
+    value literal_value;
+    std::string name;              // variables, functions, methods and operators
+    std::vector<node_ptr> children; // operands, arguments, or the receiver followed by the arguments
+    std::shared_ptr<block const> blk;
+    std::vector<std::string> params; // for `def`
+    bool has_arguments = false;     // whether a call has parentheses
+    bool exclusive = false;         // for `...` ranges
+    int line = 0;
+};
+
+class parser {
+    std::vector<token> tokens_;
+    std::size_t pos_ = 0;
+
+    token const& peek() const { return tokens_[pos_]; }
+
+    [[noreturn]] void fail(std::string const& what) const {
+        throw std::runtime_error("line " + std::to_string(peek().line) + ": " + what);
+    }
+
+    bool is(char const* punct) const
+    { return peek().kind == token::punct && peek().str == punct; }
+
+    bool is_keyword(char const* keyword) const
+    { return peek().kind == token::identifier && peek().str == keyword; }
+
+    bool accept(char const* punct) {
+        if (!is(punct))
+            return false;
+        ++pos_;
+        return true;
+    }
+
+    void expect(char const* punct) {
+        if (!accept(punct))
+            fail(std::string("expected '") + punct + "'");
+    }
+
+    void expect_keyword(char const* keyword) {
+        if (!is_keyword(keyword))
+            fail(std::string("expected '") + keyword + "'");
+        ++pos_;
+    }
+
+    void skip_newlines() {
+        while (peek().kind == token::newline)
+            ++pos_;
+    }
+
+    std::shared_ptr<node> make(node::kind_t kind) const {
+        auto n = std::make_shared<node>();
+        n->kind = kind;
+        n->line = peek().line;
+        return n;
+    }
+
+    bool at_statements_end() const {
+        return peek().kind == token::end || is("}") || is(")") ||
+               is_keyword("end") || is_keyword("else") || is_keyword("elsif");
+    }
+
+    node_ptr parse_statements() {
+        auto seq = make(node::sequence);
+        skip_newlines();
+        while (!at_statements_end()) {
+            seq->children.push_back(parse_statement());
+            skip_newlines();
+        }
+        return seq;
+    }
+
+    node_ptr parse_statement() {
+        if (peek().kind == token::text) {
+            auto n = make(node::text);
+            n->literal_value = value::make_string(peek().str);
+            ++pos_;
+            return n;
+        }
+        if (peek().kind == token::output) {
+            auto n = make(node::output);
+            ++pos_;
+            n->children.push_back(parse_expression());
+            return n;
+        }
+        if (is_keyword("def")) {
+            auto n = make(node::def);
+            ++pos_;
+            if (peek().kind != token::identifier)
+                fail("expected a method name");
+            n->name = peek().str;
+            ++pos_;
+            if (accept("(")) {
+                while (!accept(")")) {
+                    if (peek().kind != token::identifier)
+                        fail("expected a parameter name");
+                    n->params.push_back(peek().str);
+                    ++pos_;
+                    accept(",");
+                }
+            }
+            n->children.push_back(parse_statements());
+            expect_keyword("end");
+            return n;
+        }
+        if (is_keyword("if") || is_keyword("unless"))
+            return parse_conditional();
+        return parse_expression();
+    }
+
+    node_ptr parse_conditional() {
+        bool negate = peek().str == "unless";
+        auto n = make(node::conditional);
+        ++pos_;
+        node_ptr condition = parse_expression();
+        if (negate) {
+            auto not_ = make(node::unary);
+            not_->name = "!";
+            not_->children.push_back(condition);
+            condition = not_;
+        }
+        n->children.push_back(condition);
+        n->children.push_back(parse_statements());
+        if (is_keyword("elsif")) {
+            n->children.push_back(parse_conditional());
+            return n;
+        }
+        if (is_keyword("else")) {
+            ++pos_;
+            n->children.push_back(parse_statements());
+        }
+        expect_keyword("end");
+        return n;
+    }
+
+    node_ptr parse_expression() {
+        if (peek().kind == token::identifier && pos_ + 1 < tokens_.size() &&
+            tokens_[pos_ + 1].kind == token::punct && tokens_[pos_ + 1].str == "=") {
+            auto n = make(node::assign);
+            n->name = peek().str;
+            pos_ += 2;
+            n->children.push_back(parse_expression());
+            return n;
+        }
+        if (is_keyword("not")) {
+            auto n = make(node::unary);
+            n->name = "!";
+            ++pos_;
+            n->children.push_back(parse_expression());
+            return n;
+        }
+        return parse_ternary();
+    }
+
+    node_ptr parse_ternary() {
+        node_ptr condition = parse_range();
+        if (!accept("?"))
+            return condition;
+        auto n = make(node::conditional);
+        n->children.push_back(condition);
+        n->children.push_back(parse_ternary());
+        expect(":");
+        n->children.push_back(parse_ternary());
+        return n;
+    }
+
+    node_ptr parse_range() {
+        node_ptr first = parse_binary(0);
+        if (!is("..") && !is("..."))
+            return first;
+        auto n = make(node::range);
+        n->exclusive = peek().str == "...";
+        ++pos_;
+        n->children.push_back(first);
+        n->children.push_back(parse_binary(0));
+        return n;
+    }
+
+    // Binary operators, from the lowest to the highest precedence
+    node_ptr parse_binary(std::size_t level) {
+        static std::vector<std::vector<char const*>> const levels = {
+            {"||"}, {"&&"}, {"==", "!="}, {"<", ">", "<=", ">="}, {"+", "-"}, {"*", "/", "%"}
+        };
+        if (level == levels.size())
+            return parse_unary();
+
+        node_ptr left = parse_binary(level + 1);
+        while (true) {
+            char const* op = nullptr;
+            for (char const* candidate : levels[level])
+                if (is(candidate))
+                    op = candidate;
+            if (op == nullptr)
+                return left;
+            ++pos_;
+            auto n = make(std::strcmp(op, "&&") == 0 ? node::logical_and
+                        : std::strcmp(op, "||") == 0 ? node::logical_or
+                        : node::binary);
+            n->name = op;
+            n->children.push_back(left);
+            n->children.push_back(parse_binary(level + 1));
+            left = n;
+        }
+    }
+
+    node_ptr parse_unary() {
+        if (is("-") || is("!")) {
+            auto n = make(node::unary);
+            n->name = peek().str;
+            ++pos_;
+            n->children.push_back(parse_unary());
+            return n;
+        }
+        return parse_postfix();
+    }
+
+    void parse_arguments(node& call) {
+        if (!accept("("))
+            return;
+        call.has_arguments = true;
+        while (!accept(")")) {
+            call.children.push_back(parse_expression());
+            if (!is(")"))
+                expect(",");
+        }
+    }
+
+    std::shared_ptr<block const> parse_block() {
+        bool braces = is("{");
+        if (!braces && !is_keyword("do"))
+            return nullptr;
+        ++pos_;
+        auto b = std::make_shared<block>();
+        if (accept("|")) {
+            while (!accept("|")) {
+                if (peek().kind != token::identifier)
+                    fail("expected a block parameter");
+                b->params.push_back(peek().str);
+                ++pos_;
+                accept(",");
+            }
+        }
+        b->body = parse_statements();
+        if (braces)
+            expect("}");
+        else
+            expect_keyword("end");
+        return b;
+    }
+
+    node_ptr parse_postfix() {
+        node_ptr result = parse_primary();
+        while (true) {
+            if (accept(".")) {
+                if (peek().kind != token::identifier)
+                    fail("expected a method name");
+                auto n = make(node::method);
+                n->name = peek().str;
+                ++pos_;
+                n->children.push_back(result);
+                parse_arguments(*n);
+                n->blk = parse_block();
+                result = n;
+            } else if (accept("[")) {
+                auto n = make(node::index);
+                n->children.push_back(result);
+                n->children.push_back(parse_expression());
+                expect("]");
+                result = n;
+            } else {
+                return result;
+            }
+        }
+    }
+
+    node_ptr parse_interpolation(std::string const& raw) {
+        auto n = make(node::interpolation);
+        std::string chunk;
+        auto flush = [&] {
+            if (chunk.empty())
+                return;
+            auto lit = make(node::literal);
+            lit->literal_value = value::make_string(chunk);
+            n->children.push_back(lit);
+            chunk.clear();
+        };
+        for (std::size_t k = 0; k < raw.size(); ++k) {
+            if (raw[k] == '\\' && k + 1 < raw.size()) {
+                char c = raw[++k];
+                chunk += c == 'n' ? '\n' : c == 't' ? '\t' : c == '0' ? '\0' : c;
+            } else if (raw[k] == '#' && k + 1 < raw.size() && raw[k + 1] == '{') {
+                std::size_t start = k + 2, depth = 1;
+                for (k = start; k < raw.size() && depth != 0; ++k)
+                    depth += raw[k] == '{' ? 1 : raw[k] == '}' ? -1 : 0;
+                if (depth != 0)
+                    fail("unterminated interpolation");
+                --k;
+                flush();
+                std::string code = raw.substr(start, k - start);
+                n->children.push_back(parser(lexer(code).code()).parse_program());
+            } else {
+                chunk += raw[k];
+            }
+        }
+        flush();
+        return n;
+    }
+
+    node_ptr parse_primary() {
+        token const& t = peek();
+        if (t.kind == token::integer || t.kind == token::floating || t.kind == token::symbol) {
+            auto n = make(node::literal);
+            n->literal_value = t.kind == token::integer ? value::make_int(t.i)
+                             : t.kind == token::floating ? value::make_float(t.f)
+                             : value::make_symbol(t.str);
+            ++pos_;
+            return n;
+        }
+        if (t.kind == token::string) {
+            ++pos_;
+            if (t.interpolated)
+                return parse_interpolation(t.str);
+            auto n = make(node::literal);
+            n->literal_value = value::make_string(t.str);
+            return n;
+        }
+        if (accept("(")) {
+            node_ptr result = parse_statements();
+            expect(")");
+            return result;
+        }
+        if (accept("[")) {
+            auto n = make(node::array);
+            while (!accept("]")) {
+                n->children.push_back(parse_expression());
+                if (!is("]"))
+                    expect(",");
+            }
+            return n;
+        }
+        if (t.kind == token::identifier) {
+            if (t.str == "true" || t.str == "false" || t.str == "nil") {
+                auto n = make(node::literal);
+                if (t.str != "nil")
+                    n->literal_value = value::make_bool(t.str == "true");
+                ++pos_;
+                return n;
+            }
+            auto n = make(node::identifier);
+            n->name = t.str;
+            ++pos_;
+            parse_arguments(*n);
+            n->blk = parse_block();
+            return n;
+        }
+        fail("unexpected " + (t.kind == token::end ? std::string("end of input") : "'" + t.str + "'"));
+    }
+
+public:
+    explicit parser(std::vector<token> tokens) : tokens_(std::move(tokens)) { }
+
+    node_ptr parse_program() {
+        node_ptr program = parse_statements();
+        if (peek().kind != token::end)
+            fail("unexpected '" + peek().str + "'");
+        return program;
+    }
+};
+
+node_ptr parse_template(std::string const& source)
+{ return parser(lexer(source).erb()).parse_program(); }
+
+//////////////////////////////////////////////////////////////////////////////
+// Interpreter
+//////////////////////////////////////////////////////////////////////////////
+struct scope {
+    std::map<std::string, value> variables;
+    scope* parent = nullptr;
+
+    value* find(std::string const& name) {
+        for (scope* s = this; s != nullptr; s = s->parent) {
+            auto it = s->variables.find(name);
+            if (it != s->variables.end())
+                return &it->second;
+        }
+        return nullptr;
+    }
+
+    void assign(std::string const& name, value v) {
+        if (value* existing = find(name))
+            *existing = std::move(v);
+        else
+            variables[name] = std::move(v);
+    }
+};
+
+class interpreter {
+public:
+    using builtin = std::function<value(std::vector<value>&)>;
+
+private:
+    std::map<std::string, builtin> builtins_;
+    std::map<std::string, node_ptr> functions_;
+    std::string* output_ = nullptr;
+
+    [[noreturn]] static void fail(node const& n, std::string const& what) {
+        throw std::runtime_error("line " + std::to_string(n.line) + ": " + what);
+    }
+
+    static std::vector<value>& as_array(node const& n, value& v) {
+        if (v.kind != value::array)
+            fail(n, "expected an array, got " + inspect(v));
+        return *v.a;
+    }
+
+    static long long as_int(node const& n, value const& v) {
+        if (v.kind != value::integer)
+            fail(n, "expected an integer, got " + inspect(v));
+        return v.i;
+    }
+
+    static bool equal(value const& x, value const& y) {
+        if (x.numeric() && y.numeric())
+            return x.as_double() == y.as_double();
+        if (x.kind != y.kind)
+            return false;
+        switch (x.kind) {
+            case value::nil: return true;
+            case value::boolean: return x.i == y.i;
+            case value::string: case value::symbol: return x.s == y.s;
+            case value::array:
+                return x.a->size() == y.a->size() &&
+                       std::equal(x.a->begin(), x.a->end(), y.a->begin(), equal);
+            default: return false;
+        }
+    }
+
+    static bool less(node const& n, value const& x, value const& y) {
+        if (x.numeric() && y.numeric())
+            return x.as_double() < y.as_double();
+        if (x.kind == value::string && y.kind == value::string)
+            return x.s < y.s;
+        fail(n, "can't compare " + inspect(x) + " with " + inspect(y));
+    }
+
+    static value binary(node const& n, std::string const& op, value const& x, value const& y) {
+        if (op == "==") return value::make_bool(equal(x, y));
+        if (op == "!=") return value::make_bool(!equal(x, y));
+        if (op == "<") return value::make_bool(less(n, x, y));
+        if (op == ">") return value::make_bool(less(n, y, x));
+        if (op == "<=") return value::make_bool(!less(n, y, x));
+        if (op == ">=") return value::make_bool(!less(n, x, y));
+
+        if (x.kind == value::integer && y.kind == value::integer) {
+            long long a = x.i, b = y.i;
+            if (op == "+") return value::make_int(a + b);
+            if (op == "-") return value::make_int(a - b);
+            if (op == "*") return value::make_int(a * b);
+            if (op == "/" || op == "%") {
+                if (b == 0)
+                    fail(n, "divided by 0");
+                // Integer division rounds towards negative infinity
+                long long q = a / b - ((a % b != 0 && (a < 0) != (b < 0)) ? 1 : 0);
+                return value::make_int(op == "/" ? q : a - q * b);
+            }
+        }
+        if (x.numeric() && y.numeric()) {
+            double a = x.as_double(), b = y.as_double();
+            if (op == "+") return value::make_float(a + b);
+            if (op == "-") return value::make_float(a - b);
+            if (op == "*") return value::make_float(a * b);
+            if (op == "/") return value::make_float(a / b);
+            if (op == "%") return value::make_float(a - std::floor(a / b) * b);
+        }
+        if (x.kind == value::string && y.kind == value::string && op == "+")
+            return value::make_string(x.s + y.s);
+        if (x.kind == value::array && y.kind == value::array && op == "+") {
+            std::vector<value> xs(*x.a);
+            xs.insert(xs.end(), y.a->begin(), y.a->end());
+            return value::make_array(std::move(xs));
+        }
+        if (x.kind == value::string && y.kind == value::integer && op == "*") {
+            std::string result;
+            for (long long k = 0; k < y.i; ++k)
+                result += x.s;
+            return value::make_string(result);
+        }
+        fail(n, "undefined operator " + op + " for " + inspect(x) + " and " + inspect(y));
+    }
+
+    value call_block(block const& b, std::vector<value> args, scope& outer) {
+        scope local;
+        local.parent = &outer;
+        // A single array argument is destructured over several parameters
+        if (b.params.size() > 1 && args.size() == 1 && args[0].kind == value::array) {
+            std::vector<value> elements = *args[0].a;
+            args = std::move(elements);
+        }
+        for (std::size_t k = 0; k != b.params.size(); ++k)
+            local.variables[b.params[k]] = k < args.size() ? args[k] : value{};
+        return eval(*b.body, local);
+    }
+
+    value call_function(node const& n, std::vector<value>& args) {
+        auto function = functions_.find(n.name);
+        if (function != functions_.end()) {
+            node const& def = *function->second;
+            if (args.size() != def.params.size())
+                fail(n, "wrong number of arguments for " + n.name);
+            scope local; // methods do not see the enclosing variables
+            for (std::size_t k = 0; k != args.size(); ++k)
+                local.variables[def.params[k]] = args[k];
+            return eval(*def.children[0], local);
+        }
+        auto b = builtins_.find(n.name);
+        if (b != builtins_.end())
+            return b->second(args);
+        fail(n, "undefined method or variable '" + n.name + "'");
+    }
+
+    value call_method(node const& n, value receiver, std::vector<value>& args, scope& s) {
+        std::string const& m = n.name;
+        block const* blk = n.blk.get();
+
+        if (m == "to_s") return value::make_string(to_s(receiver));
+        if (m == "inspect") return value::make_string(inspect(receiver));
+
+        if (receiver.kind == value::integer) {
+            if (m == "even?") return value::make_bool(receiver.i % 2 == 0);
+            if (m == "odd?") return value::make_bool(receiver.i % 2 != 0);
+            if (m == "to_i") return receiver;
+            if (m == "to_f") return value::make_float(static_cast<double>(receiver.i));
+            if (m == "abs") return value::make_int(std::llabs(receiver.i));
+            if (m == "times") {
+                std::vector<value> xs;
+                for (long long k = 0; k < receiver.i; ++k)
+                    xs.push_back(value::make_int(k));
+                if (blk == nullptr)
+                    return value::make_array(std::move(xs));
+                for (value const& x : xs)
+                    call_block(*blk, {x}, s);
+                return receiver;
+            }
+        }
+
+        if (receiver.kind == value::floating) {
+            if (m == "to_f") return receiver;
+            if (m == "to_i") return value::make_int(static_cast<long long>(receiver.f));
+            if (m == "round") return value::make_int(std::llround(receiver.f));
+        }
+
+        if (receiver.kind == value::string) {
+            if (m == "length" || m == "size") return value::make_int(static_cast<long long>(receiver.s.size()));
+            if (m == "to_i") return value::make_int(std::atoll(receiver.s.c_str()));
+            if (m == "to_f") return value::make_float(std::atof(receiver.s.c_str()));
+            if (m == "downcase") {
+                std::string result = receiver.s;
+                for (char& c : result)
+                    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                return value::make_string(result);
+            }
+            if (m == "empty?") return value::make_bool(receiver.s.empty());
+        }
+
+        if (receiver.kind == value::array) {
+            std::vector<value>& xs = *receiver.a;
+            if (m == "to_a" || m == "entries") return receiver;
+            if (m == "length" || m == "size" || m == "count") return value::make_int(static_cast<long long>(xs.size()));
+            if (m == "empty?") return value::make_bool(xs.empty());
+            if (m == "first") return xs.empty() ? value{} : xs.front();
+            if (m == "last") return xs.empty() ? value{} : xs.back();
+            if (m == "reverse") return value::make_array(std::vector<value>(xs.rbegin(), xs.rend()));
+            if (m == "shift") {
+                if (xs.empty())
+                    return value{};
+                value first = xs.front();
+                xs.erase(xs.begin());
+                return first;
+            }
+            if (m == "join") {
+                std::string separator = args.empty() ? "" : to_s(args[0]);
+                std::string result;
+                for (std::size_t k = 0; k != xs.size(); ++k)
+                    result += (k ? separator : "") + to_s(xs[k]);
+                return value::make_string(result);
+            }
+            if (m == "step") {
+                // Ranges are represented by arrays, so `(a..b).step(n)` is
+                // every n-th element of the array.
+                long long step = args.empty() ? 1 : as_int(n, args[0]);
+                if (step <= 0)
+                    fail(n, "step can't be negative or 0");
+                std::vector<value> result;
+                for (std::size_t k = 0; k < xs.size(); k += static_cast<std::size_t>(step))
+                    result.push_back(xs[k]);
+                return value::make_array(std::move(result));
+            }
+            if (m == "max" || m == "min") {
+                if (xs.empty())
+                    return value{};
+                value best = xs.front();
+                for (value const& x : xs)
+                    if (m == "max" ? less(n, best, x) : less(n, x, best))
+                        best = x;
+                return best;
+            }
+            if (m == "map" || m == "collect" || m == "each") {
+                if (blk == nullptr)
+                    fail(n, m + " requires a block");
+                std::vector<value> result;
+                for (value const& x : std::vector<value>(xs))
+                    result.push_back(call_block(*blk, {x}, s));
+                return m == "each" ? receiver : value::make_array(std::move(result));
+            }
+            if (m == "sum" || m == "inject" || m == "reduce") {
+                std::vector<value> elements(xs);
+                value accumulator;
+                std::string op = m == "sum" ? "+" : "";
+                if (m == "sum")
+                    accumulator = args.empty() ? value::make_int(0) : args[0];
+                else if (!args.empty() && args.back().kind == value::symbol) {
+                    op = args.back().s;
+                    if (args.size() == 2)
+                        accumulator = args[0];
+                } else if (!args.empty())
+                    accumulator = args[0];
+
+                if (accumulator.kind == value::nil) {
+                    if (elements.empty())
+                        return value{};
+                    accumulator = elements.front();
+                    elements.erase(elements.begin());
+                }
+                for (value const& x : elements) {
+                    if (!op.empty())
+                        accumulator = binary(n, op, accumulator, x);
+                    else if (blk != nullptr)
+                        accumulator = call_block(*blk, {accumulator, x}, s);
+                    else
+                        fail(n, m + " requires a block or a symbol");
+                }
+                return accumulator;
+            }
+        }
+
+        fail(n, "undefined method '" + m + "' for " + inspect(receiver));
+    }
+
+    std::vector<value> eval_arguments(node const& n, std::size_t first, scope& s) {
+        std::vector<value> args;
+        for (std::size_t k = first; k < n.children.size(); ++k)
+            args.push_back(eval(*n.children[k], s));
+        return args;
+    }
+
+public:
+    void define(std::string const& name, builtin f)
+    { builtins_[name] = std::move(f); }
+
+    std::string render(node const& program, scope& globals) {
+        std::string result;
+        std::string* previous = output_;
+        output_ = &result;
+        try {
+            eval(program, globals);
+        } catch (...) {
+            output_ = previous;
+            throw;
+        }
+        output_ = previous;
+        return result;
+    }
+
+    value eval(node const& n, scope& s) {
+        switch (n.kind) {
+            case node::literal:
+                return n.literal_value;
+
+            case node::text:
+                *output_ += n.literal_value.s;
+                return value{};
+
+            case node::output:
+                *output_ += to_s(eval(*n.children[0], s));
+                return value{};
+
+            case node::interpolation: {
+                std::string result;
+                for (node_ptr const& child : n.children)
+                    result += to_s(eval(*child, s));
+                return value::make_string(result);
+            }
+
+            case node::array:
+                return value::make_array(eval_arguments(n, 0, s));
+
+            case node::identifier: {
+                if (!n.has_arguments && n.blk == nullptr)
+                    if (value* variable = s.find(n.name))
+                        return *variable;
+                std::vector<value> args = eval_arguments(n, 0, s);
+                return call_function(n, args);
+            }
+
+            case node::assign: {
+                value v = eval(*n.children[0], s);
+                s.assign(n.name, v);
+                return v;
+            }
+
+            case node::method: {
+                value receiver = eval(*n.children[0], s);
+                std::vector<value> args = eval_arguments(n, 1, s);
+                return call_method(n, receiver, args, s);
+            }
+
+            case node::index: {
+                value receiver = eval(*n.children[0], s);
+                value key = eval(*n.children[1], s);
+                std::vector<value>& xs = as_array(n, receiver);
+                long long k = as_int(n, key);
+                if (k < 0)
+                    k += static_cast<long long>(xs.size());
+                return k >= 0 && k < static_cast<long long>(xs.size()) ? xs[static_cast<std::size_t>(k)] : value{};
+            }
+
+            case node::unary: {
+                value v = eval(*n.children[0], s);
+                if (n.name == "!")
+                    return value::make_bool(!v.truthy());
+                if (v.kind == value::integer) return value::make_int(-v.i);
+                if (v.kind == value::floating) return value::make_float(-v.f);
+                fail(n, "undefined operator - for " + inspect(v));
+            }
+
+            case node::binary:
+                return binary(n, n.name, eval(*n.children[0], s), eval(*n.children[1], s));
+
+            case node::logical_and: {
+                value left = eval(*n.children[0], s);
+                return left.truthy() ? eval(*n.children[1], s) : left;
+            }
+
+            case node::logical_or: {
+                value left = eval(*n.children[0], s);
+                return left.truthy() ? left : eval(*n.children[1], s);
+            }
+
+            case node::conditional:
+                if (eval(*n.children[0], s).truthy())
+                    return eval(*n.children[1], s);
+                return n.children.size() > 2 ? eval(*n.children[2], s) : value{};
+
+            case node::sequence: {
+                value last;
+                for (node_ptr const& child : n.children)
+                    last = eval(*child, s);
+                return last;
+            }
+
+            case node::def:
+                functions_[n.name] = std::make_shared<node>(n);
+                return value::make_symbol(n.name);
+
+            case node::range: {
+                // Ranges are expanded to arrays right away
+                long long first = as_int(n, eval(*n.children[0], s));
+                long long last = as_int(n, eval(*n.children[1], s));
+                if (n.exclusive)
+                    --last;
+                std::vector<value> xs;
+                for (long long k = first; k <= last; ++k)
+                    xs.push_back(value::make_int(k));
+                return value::make_array(std::move(xs));
+            }
+        }
+        return value{};
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Helpers available to the templates, see `measure.in.rb`
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> strings_of(value const& xs) {
+    std::vector<std::string> result;
+    if (xs.kind == value::array)
+        for (value const& x : *xs.a)
+            result.push_back(to_s(x));
+    return result;
+}
+
+std::string join(std::vector<std::string>::const_iterator first,
+                 std::vector<std::string>::const_iterator last)
+{
+    std::string result;
+    for (auto it = first; it != last; ++it)
+        result += (it == first ? "" : ", ") + *it;
+    return result;
+}
+
+void define_helpers(interpreter& interp) {
+    auto argument = [](std::vector<value>& args) -> value& {
+        if (args.empty())
+            throw std::runtime_error("wrong number of arguments");
+        return args[0];
+    };
+
+    interp.define("mpl_vector", [=](std::vector<value>& args) {
+        std::vector<std::string> types = strings_of(argument(args));
+        std::size_t fast = std::min<std::size_t>(20, types.size());
+        std::string v = "boost::mpl::vector" + std::to_string(fast) + "<" +
+                        join(types.begin(), types.begin() + fast) + ">";
+        for (std::size_t k = fast; k < types.size(); ++k)
+            v = "boost::mpl::push_back<" + v + ", " + types[k] + ">::type";
+        return value::make_string(v);
+    });
+
+    interp.define("mpl_list", [=](std::vector<value>& args) {
+        std::vector<std::string> types = strings_of(argument(args));
+        std::size_t prefix = types.size() > 20 ? types.size() - 20 : 0;
+        std::string l = "boost::mpl::list" + std::to_string(types.size() - prefix) + "<" +
+                        join(types.begin() + prefix, types.end()) + ">";
+        for (std::size_t k = prefix; k-- > 0; )
+            l = "boost::mpl::push_front<" + l + ", " + types[k] + ">::type";
+        return value::make_string(l);
+    });
+
+    auto fusion = [=](std::string make) {
+        return [=](std::vector<value>& args) {
+            std::vector<std::string> values = strings_of(argument(args));
+            std::size_t fast = std::min<std::size_t>(10, values.size());
+            std::string xs = "boost::fusion::" + make + "(" +
+                             join(values.begin(), values.begin() + fast) + ")";
+            for (std::size_t k = fast; k < values.size(); ++k)
+                xs = "boost::fusion::push_back(" + xs + ", " + values[k] + ")";
+            return value::make_string(xs);
+        };
+    };
+    interp.define("fusion_vector", fusion("make_vector"));
+    interp.define("fusion_list", fusion("make_list"));
+
+    interp.define("cmake_bool", [=](std::vector<value>& args) {
+        value const& b = argument(args);
+        if (b.kind == value::string) {
+            std::string lower = b.s;
+            for (char& c : lower)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return value::make_bool(lower == "true" || lower == "yes" || lower == "1");
+        }
+        return value::make_bool(b.kind == value::integer && b.i > 0);
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Driving CMake
+//////////////////////////////////////////////////////////////////////////////
+std::string read_file(std::string const& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("could not read " + path);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void write_file(std::string const& path, std::string const& contents) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        throw std::runtime_error("could not write to " + path);
+    out << contents;
+}
+
+void set_environment(char const* name, char const* value) {
+#if defined(_WIN32)
+    _putenv_s(name, value ? value : "");
+#else
+    if (value) ::setenv(name, value, 1);
+    else       ::unsetenv(name);
+#endif
+}
+
+std::string quote(std::string const& arg)
+{ return "\"" + arg + "\""; }
+
+// Runs a command and returns its standard output, and whether it succeeded.
+std::pair<std::string, bool> run(std::string const& command) {
+    std::FILE* pipe = popen(command.c_str(), "r");
+    if (pipe == nullptr)
+        throw std::runtime_error("could not run " + command);
+    std::string output;
+    char buffer[4096];
+    std::size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), pipe)) != 0)
+        output.append(buffer, n);
+    return {output, pclose(pipe) == 0};
+}
+
+// Returns the number captured by `[<label>: <number>]` in the given output.
+bool find_statistic(std::string const& output, std::string const& label, double& result) {
+    std::string prefix = "[" + label + ": ";
+    std::size_t at = output.find(prefix);
+    if (at == std::string::npos)
+        return false;
+    result = std::strtod(output.c_str() + at + prefix.size(), nullptr);
+    return true;
+}
+
+struct benchmark_driver {
+    std::string cmake, binary_dir, measure_target, measure_file, measure_executable;
+    std::map<std::string, node_ptr> templates;
+
+    std::string build(std::string const& target, bool& success) const {
+        auto result = run(quote(cmake) + " --build " + quote(binary_dir) + " --target " + target);
+        success = result.second;
+        return result.first;
+    }
+
+    node_ptr const& template_for(std::string const& path) {
+        node_ptr& t = templates[path];
+        if (!t) {
+            try {
+                t = parse_template(read_file(path));
+            } catch (std::runtime_error const& e) {
+                throw std::runtime_error(path + ": " + e.what());
+            }
+        }
+        return t;
+    }
+
+    value measure(interpreter& interp, std::string const& aspect,
+                  std::string const& file, value range)
+    {
+        if (range.kind != value::array)
+            throw std::runtime_error("the input sizes must be an array");
+        std::vector<value> sizes = *range.a;
+        if (std::getenv("BOOST_HANA_JUST_CHECK_BENCHMARKS") && sizes.size() >= 2)
+            sizes = {sizes.front(), sizes.back()};
+
+        node_ptr const& program = template_for(file);
+        std::vector<value> results;
+        try {
+            for (std::size_t k = 0; k != sizes.size(); ++k) {
+                std::fprintf(stderr, "\r%3d%% %s | %zu/%zu |",
+                    static_cast<int>(100 * k / sizes.size()), file.c_str(), k, sizes.size());
+                std::fflush(stderr);
+
+                scope globals;
+                globals.variables["input_size"] = sizes[k];
+                std::string code = interp.render(*program, globals);
+                results.push_back(value::make_array({sizes[k], value::make_float(measure_one(aspect, code))}));
+            }
+        } catch (...) {
+            write_file(measure_file, "");
+            throw;
+        }
+        write_file(measure_file, "");
+        std::fprintf(stderr, "\r100%% %s | %zu/%zu |\n", file.c_str(), sizes.size(), sizes.size());
+        return value::make_array(std::move(results));
+    }
+
+    double measure_one(std::string const& aspect, std::string const& code) {
+        write_file(measure_file, code);
+
+        // Compile the file and get the statistics printed by the launcher.
+        std::string output;
+        double stat = 0, compilation_time = 0;
+        while (true) {
+            bool success;
+            set_environment("BOOST_HANA_COUNT_INSTANTIATIONS", aspect == "instantiations" ? "1" : nullptr);
+            output = build(measure_target, success);
+            set_environment("BOOST_HANA_COUNT_INSTANTIATIONS", nullptr);
+            if (!success)
+                throw std::runtime_error("compilation error: " + output + "\n\n" + code);
+
+            // If the statistics are missing, CMake did not notice that the
+            // measure file changed and the target was not rebuilt. So we
+            // sleep for a bit and then try again.
+            if (find_statistic(output, "compilation time", compilation_time))
+                break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+
+        if (aspect == "compilation_time")
+            stat = compilation_time;
+        else if (aspect == "bloat")
+            stat = static_cast<double>(read_file(measure_executable).size()) / 1000;
+        else if (aspect == "peak_memory" || aspect == "instantiations") {
+            std::string label = aspect == "peak_memory" ? "peak memory" : "instantiations";
+            if (!find_statistic(output, label, stat))
+                throw std::runtime_error("Could not find [" + label + ": ...] bit in the "
+                    "output. This aspect may not be supported by the compiler or the "
+                    "platform. stdout follows:\n" + output);
+        } else if (aspect == "execution_time") {
+            bool success;
+            output = build(measure_target + ".run", success);
+            if (!success)
+                throw std::runtime_error("runtime error: " + output + "\n\n" + code);
+            if (!find_statistic(output, "execution time", stat))
+                throw std::runtime_error("Could not find [execution time: ...] bit in the "
+                    "output. Did you use the `measure` function in the `measure.hpp` "
+                    "header? stdout follows:\n" + output);
+        } else {
+            throw std::runtime_error("unknown aspect " + aspect);
+        }
+        return stat;
+    }
+
+    void define(interpreter& interp) {
+        auto measure_as = [&interp, this](std::string aspect) {
+            return [&interp, this, aspect](std::vector<value>& args) {
+                if (args.size() < 2)
+                    throw std::runtime_error("wrong number of arguments");
+                return measure(interp, aspect, to_s(args[0]), args[1]);
+            };
+        };
+        interp.define("time_compilation", measure_as("compilation_time"));
+        interp.define("time_execution", measure_as("execution_time"));
+        interp.define("peak_memory", measure_as("peak_memory"));
+        interp.define("count_instantiations", measure_as("instantiations"));
+        interp.define("measure", [&interp, this](std::vector<value>& args) {
+            if (args.size() < 3)
+                throw std::runtime_error("wrong number of arguments");
+            return measure(interp, to_s(args[0]), to_s(args[1]), args[2]);
+        });
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Compiler launcher
+//////////////////////////////////////////////////////////////////////////////
+// Returns the number of template instantiations reported by a compiler
+// given the flags returned by `instantiation_flags`, or -1.
+long count_instantiations_in(std::string const& compiler_id,
+                             std::vector<std::string> const& command,
+                             std::string const& errors)
+{
+    if (compiler_id == "GNU") {
+        std::regex specializations("(?:decl|type)_specializations: size \\d+, (\\d+) elements");
+        long count = -1;
+        for (std::sregex_iterator it(errors.begin(), errors.end(), specializations), last; it != last; ++it)
+            count = (count < 0 ? 0 : count) + std::atol((*it)[1].str().c_str());
+        return count;
+    }
+
+    auto output = std::find(command.begin(), command.end(), "-o");
+    if (output == command.end() || output + 1 == command.end())
+        return -1;
+    std::string trace = *(output + 1);
+    std::size_t dot = trace.find_last_of("./");
+    if (dot != std::string::npos && trace[dot] == '.')
+        trace.erase(dot);
+    std::ifstream in(trace + ".json");
+    if (!in)
+        return -1;
+    std::string contents{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    long count = 0;
+    for (char const* name : {"\"InstantiateClass\"", "\"InstantiateFunction\""})
+        for (std::size_t at = contents.find(name); at != std::string::npos; at = contents.find(name, at + 1))
+            ++count;
+    return count;
+}
+
+int launch(std::string const& compiler_id, std::vector<std::string> command) {
+    bool counting = std::getenv("BOOST_HANA_COUNT_INSTANTIATIONS") != nullptr;
+    if (counting && compiler_id == "GNU")
+        command.push_back("-fstats");
+    else if (counting && (compiler_id == "Clang" || compiler_id == "AppleClang"))
+        command.insert(command.end(), {"-ftime-trace", "-ftime-trace-granularity=0"});
+    else
+        counting = false;
+
+    std::vector<char*> argv;
+    for (std::string& arg : command)
+        argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    double peak_memory = -1;
+    std::string errors;
+    int status = EXIT_FAILURE;
+
+#if defined(_WIN32)
+    // The standard error can't be captured, so the instantiations are not
+    // counted, and the peak memory usage is not available.
+    counting = false;
+    status = static_cast<int>(_spawnvp(_P_WAIT, argv[0], argv.data()));
+    if (status == -1) {
+        std::perror(argv[0]);
+        return EXIT_FAILURE;
+    }
+#else
+    // The statistics printed by the compiler are not diagnostics, so the
+    // standard error is captured when counting instantiations.
+    int pipe_fds[2] = {-1, -1};
+    if (counting && ::pipe(pipe_fds) != 0) {
+        std::perror("pipe");
+        return EXIT_FAILURE;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return EXIT_FAILURE;
+    } else if (pid == 0) {
+        if (counting) {
+            ::dup2(pipe_fds[1], STDERR_FILENO);
+            ::close(pipe_fds[0]);
+            ::close(pipe_fds[1]);
+        }
+        execvp(argv[0], argv.data());
+        std::perror(argv[0]);
+        _exit(127);
+    }
+
+    if (counting) {
+        ::close(pipe_fds[1]);
+        char buffer[4096];
+        ssize_t n;
+        while ((n = ::read(pipe_fds[0], buffer, sizeof(buffer))) > 0)
+            errors.append(buffer, static_cast<std::size_t>(n));
+        ::close(pipe_fds[0]);
+    }
+
+    int wait_status = 0;
+    struct rusage usage;
+    if (wait4(pid, &wait_status, 0, &usage) < 0) {
+        std::perror("wait4");
+        return EXIT_FAILURE;
+    }
+#   if defined(__APPLE__)
+    peak_memory = usage.ru_maxrss / 1024.0 / 1024.0; // bytes on Darwin
+#   else
+    peak_memory = usage.ru_maxrss / 1024.0;
+#   endif
+    if (WIFEXITED(wait_status))
+        status = WEXITSTATUS(wait_status);
+    else
+        status = 128 + WTERMSIG(wait_status);
+#endif
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (status != 0) {
+        std::fputs(errors.c_str(), stderr);
+        return status;
+    }
+
+    std::string command_line;
+    for (std::string const& arg : command)
+        command_line += (command_line.empty() ? "" : " ") + arg;
+    std::printf("[command line: %s]\n", command_line.c_str());
+    std::printf("[compilation time: %s]\n", format_float(elapsed.count()).c_str());
+    if (peak_memory >= 0)
+        std::printf("[peak memory: %s]\n", format_float(peak_memory).c_str());
+    if (counting) {
+        long instantiations = count_instantiations_in(compiler_id, command, errors);
+        if (instantiations >= 0)
+            std::printf("[instantiations: %ld]\n", instantiations);
+    }
+    return EXIT_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Driver
+//////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    if (args.size() >= 3 && args[0] == "--launch")
+        return launch(args[1], std::vector<std::string>(args.begin() + 2, args.end()));
+
+    try {
+        interpreter interp;
+        define_helpers(interp);
+
+        if (args.size() == 3 && args[0] == "--render") {
+            scope globals;
+            globals.variables["input_size"] = value::make_int(std::atoll(args[2].c_str()));
+            std::cout << interp.render(*parse_template(read_file(args[1])), globals);
+            return EXIT_SUCCESS;
+        }
+
+        if (args.size() != 7) {
+            std::fprintf(stderr,
+                "usage: %s <cmake> <binary dir> <measure target> <measure file>\n"
+                "          <measure executable> <dataset template> <dataset>\n"
+                "       %s --launch <compiler id> <command> [args...]\n"
+                "       %s --render <template> <input size>\n", argv[0], argv[0], argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        benchmark_driver driver{args[0], args[1], args[2], args[3], args[4], {}};
+        driver.define(interp);
+
+        scope globals;
+        std::string dataset;
+        try {
+            dataset = interp.render(*parse_template(read_file(args[5])), globals);
+        } catch (std::runtime_error const& e) {
+            throw std::runtime_error(args[5] + ": " + e.what());
+        }
+        write_file(args[6], dataset);
+    } catch (std::exception const& e) {
+        std::cerr << "\n" << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
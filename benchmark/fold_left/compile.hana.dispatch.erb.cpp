@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+// Every `int_c<n>` has the same tag, `integral_constant_tag<int>`, so each
+// step of the fold dispatches `plus` to the same implementation; only the
+// types of the accumulator and of the element change. This stresses the
+// lookup of the tags of new types rather than the fold itself.
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::fold_left(tuple, boost::hana::int_c<0>,
+                                                   boost::hana::plus);
+    (void)result;
+}
@@ -28,5 +28,6 @@ int main () {
                 return state + t;
             });
         }
+        return result;
     });
 }
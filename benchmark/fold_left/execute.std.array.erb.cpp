@@ -18,5 +18,6 @@ int main () {
 
             result += std::accumulate(values.begin(), values.end(), 0);
         }
+        return result;
     });
 }
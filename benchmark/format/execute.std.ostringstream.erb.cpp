@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <sstream>
+
+
+int main () {
+    // The arguments are generated once, outside of the measured code, and
+    // are only varied cheaply inside it, so that the formatting itself
+    // dominates the measurements.
+    int values[<%= input_size %>];
+    for (int& value : values)
+        value = std::rand();
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::ostringstream out;
+            out <%= input_size.times.map { |k| "<< (values[#{k}] ^ iteration) << ' '" }.join(' ') %>;
+            result += static_cast<long long>(out.str().size());
+        }
+        return result;
+    });
+}
@@ -0,0 +1,16 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto set = hana::to_set(hana::make_tuple(
+        <%= (1..input_size).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    ));
+    (void)set;
+}
@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/count.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/minimum.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unique.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| "hana::int_c<#{(i * 67) % input_size}>" }.join(', ') %>
+    );
+
+    auto max = hana::maximum(xs);
+    auto min = hana::minimum(xs);
+    auto sorted = hana::sort(xs);
+    auto unique = hana::unique(xs);
+    auto count = hana::count(xs, hana::int_c<0>);
+    (void)max; (void)min; (void)sorted; (void)unique; (void)count;
+}
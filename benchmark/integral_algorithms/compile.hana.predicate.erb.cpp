@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/minimum.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unique.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| "hana::int_c<#{(i * 67) % input_size}>" }.join(', ') %>
+    );
+
+    // Passing the predicates explicitly compares the elements one by one,
+    // instead of looping over their values.
+    auto max = hana::maximum(xs, hana::less);
+    auto min = hana::minimum(xs, hana::less);
+    auto sorted = hana::sort(xs, hana::less);
+    auto unique = hana::unique(xs, hana::equal);
+    auto count = hana::count_if(xs, hana::equal.to(hana::int_c<0>));
+    (void)max; (void)min; (void)sorted; (void)unique; (void)count;
+}
@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto map = hana::make_map(
+        <%= (1..input_size).map { |n| "hana::make_pair(hana::int_c<#{n}>, #{n})" }.join(', ') %>
+    );
+
+    int result = 0
+        <%= (1..input_size).map { |n| "+ hana::at_key(map, hana::int_c<#{n}>)" }.join(' ') %>
+    ;
+    (void)result;
+}
@@ -5,24 +5,228 @@
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#   include <sched.h>
+#   define BOOST_HANA_BENCHMARK_HAS_CPU_PINNING
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#   if __has_include(<linux/perf_event.h>)
+#       include <linux/perf_event.h>
+#       include <sys/syscall.h>
+#       include <unistd.h>
+#       define BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+#   endif
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#   include <x86intrin.h>
+#   define BOOST_HANA_BENCHMARK_HAS_RDTSC
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+
+// `measure(f)` times calls to `f`, and writes the results to stdout. The
+// `[execution time: ...]` line holds the median time (in seconds) of one
+// call to `f`, and it is the one read by `measure.rb`; the other lines are
+// there for humans.
+//
+// The process is first pinned to the CPU it runs on, to avoid migrations.
+// `f` is then called for a while to warm up caches and branch predictors,
+// and the number of calls per sample is calibrated so that each sample
+// takes long enough to be timed accurately by `steady_clock`. Finally, a
+// fixed number of samples is taken, and their median and percentiles are
+// reported. When the CPU cycles can be counted (with `perf_event_open` on
+// Linux, or `rdtsc` on x86), the median number of cycles per call is also
+// reported; note that `rdtsc` counts reference cycles, which may differ
+// from core cycles when the CPU frequency changes.
+//
+// The result of `f`, if any, is passed to `do_not_optimize`, and memory is
+// clobbered after each call, so the work done by `f` can't be optimized
+// away. Benchmarks can also use `do_not_optimize` and `clobber_memory`
+// directly inside `f`.
+
+// The CPU_* macros use an unqualified `size_t`, which would find
+// `hana::size_t` inside Hana's namespace.
+inline void boost_hana_benchmark_pin_to_current_cpu() {
+#if defined(BOOST_HANA_BENCHMARK_HAS_CPU_PINNING)
+    int cpu = ::sched_getcpu();
+    if (cpu < 0)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    ::sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
 
 namespace boost { namespace hana { namespace benchmark {
-    auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
+    // Makes the compiler assume that `value` is read and modified in ways
+    // it can't see, so that computing it can't be optimized away.
+    template <typename T>
+    inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "m"(value) : "memory");
+#else
+        char const volatile* p = reinterpret_cast<char const volatile*>(&value);
+        (void)*p;
+        _ReadWriteBarrier();
+#endif
+    }
+
+    // Makes the compiler assume that all memory is read and modified, so
+    // that pending writes must be performed.
+    inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        _ReadWriteBarrier();
+#endif
+    }
+
+    namespace detail {
+        constexpr std::size_t samples = 31;
+        constexpr auto warmup_time = std::chrono::milliseconds(50);
+        constexpr auto sample_time = std::chrono::milliseconds(2);
+
+        using clock = std::chrono::steady_clock;
+
+        // Counts the CPU cycles spent by this thread, if possible.
+        class cycle_counter {
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENT)
+            int fd_ = -1;
+#endif
+
+        public:
+            cycle_counter() {
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENT)
+                perf_event_attr attr{};
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                fd_ = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+            }
+
+            cycle_counter(cycle_counter const&) = delete;
+            cycle_counter& operator=(cycle_counter const&) = delete;
+
+            ~cycle_counter() {
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENT)
+                if (fd_ != -1)
+                    ::close(fd_);
+#endif
+            }
+
+            bool available() const {
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENT)
+                if (fd_ != -1)
+                    return true;
+#endif
+#if defined(BOOST_HANA_BENCHMARK_HAS_RDTSC)
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            std::uint64_t now() const {
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENT)
+                std::uint64_t count = 0;
+                if (fd_ != -1 && ::read(fd_, &count, sizeof(count)) == sizeof(count))
+                    return count;
+#endif
+#if defined(BOOST_HANA_BENCHMARK_HAS_RDTSC)
+                return __rdtsc();
+#else
+                return 0;
+#endif
+            }
+        };
+
+        template <typename F>
+        inline void call(F& f, std::true_type) {
             f();
+            benchmark::clobber_memory();
+        }
+
+        template <typename F>
+        inline void call(F& f, std::false_type) {
+            auto result = f();
+            benchmark::do_not_optimize(result);
+            benchmark::clobber_memory();
+        }
+
+        template <typename F>
+        inline void call(F& f) {
+            detail::call(f, std::is_void<decltype(f())>{});
+        }
+
+        template <typename F>
+        inline clock::duration run(F& f, std::size_t iterations) {
+            auto start = clock::now();
+            for (std::size_t i = 0; i != iterations; ++i)
+                detail::call(f);
+            return clock::now() - start;
+        }
+
+        // Returns the element at the given fraction of a sorted vector.
+        template <typename T>
+        inline T percentile(std::vector<T> const& sorted, double fraction) {
+            return sorted[static_cast<std::size_t>(fraction * (sorted.size() - 1) + 0.5)];
+        }
+    }
+
+    auto measure = [](auto f) {
+        using Seconds = std::chrono::duration<double>;
+        ::boost_hana_benchmark_pin_to_current_cpu();
+
+        // Warm up, and find how many calls are needed for a sample to last
+        // at least `sample_time`.
+        std::size_t iterations = 1;
+        auto warmup_end = detail::clock::now() + detail::warmup_time;
+        while (true) {
+            auto elapsed = detail::run(f, iterations);
+            if (elapsed >= detail::sample_time && detail::clock::now() >= warmup_end)
+                break;
+            if (elapsed < detail::sample_time)
+                iterations *= 2;
+        }
+
+        std::vector<double> times, cycles;
+        detail::cycle_counter counter;
+        for (std::size_t sample = 0; sample != detail::samples; ++sample) {
+            std::uint64_t cycles_start = counter.now();
+            auto elapsed = detail::run(f, iterations);
+            std::uint64_t cycles_stop = counter.now();
+
+            times.push_back(Seconds(elapsed).count() / iterations);
+            cycles.push_back(static_cast<double>(cycles_stop - cycles_start) / iterations);
         }
-        auto stop = std::chrono::steady_clock::now();
+        std::sort(times.begin(), times.end());
+        std::sort(cycles.begin(), cycles.end());
 
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
+        std::cout << "[execution time: " << detail::percentile(times, 0.5) << "]\n";
+        std::cout << "[execution time (min): " << times.front() << "]\n";
+        std::cout << "[execution time (p10): " << detail::percentile(times, 0.1) << "]\n";
+        std::cout << "[execution time (p90): " << detail::percentile(times, 0.9) << "]\n";
+        if (counter.available())
+            std::cout << "[cycles: " << detail::percentile(cycles, 0.5) << "]\n";
+        std::cout << "[samples: " << detail::samples << " x " << iterations << " calls]"
+                  << std::endl;
     };
 }}}
 
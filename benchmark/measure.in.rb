@@ -6,8 +6,11 @@
 #
 #
 # When called as a program, this script runs the command line given in
-# arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# arguments and returns the total time and the peak memory usage. This is
+# similar to the `time` command from Bash. If the
+# `BOOST_HANA_COUNT_INSTANTIATIONS` environment variable is set, the
+# command is assumed to be a compiler invocation, and the number of
+# template instantiations it performs is also returned.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +19,7 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -79,7 +83,59 @@ def cmake_bool(b)
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
+# Returns the peak memory usage (in MB) of the largest child process that
+# was waited for, or nil if it can't be queried on this platform.
+def children_peak_memory
+  require 'fiddle'
+  getrusage = Fiddle::Function.new(Fiddle.dlopen(nil)['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  usage = Fiddle::Pointer.malloc(256, Fiddle::RUBY_FREE)
+  rusage_children = -1
+  return nil if getrusage.call(rusage_children, usage) != 0
+
+  # `ru_maxrss` follows two `struct timeval`s, each made of two longs. It
+  # is in kilobytes on Linux, but in bytes on OS X.
+  maxrss = usage[4 * Fiddle::SIZEOF_LONG, Fiddle::SIZEOF_LONG].unpack('l!')[0]
+  maxrss /= 1024.0 if RUBY_PLATFORM =~ /darwin/
+  maxrss / 1024.0
+rescue LoadError, Fiddle::DLError
+  nil
+end
+
+# Returns the flags making the compiler report the template instantiations
+# it performs, or nil if the compiler can't do it.
+def instantiation_flags
+  case "@CMAKE_CXX_COMPILER_ID@"
+  when "GNU" then ["-fstats"]
+  when "Clang", "AppleClang" then ["-ftime-trace", "-ftime-trace-granularity=0"]
+  end
+end
+
+# Returns the number of template instantiations reported by a compiler
+# invoked with `instantiation_flags`, or nil if none were reported.
+#
+# GCC reports the number of specializations of class templates and of
+# function and variable templates on stderr. Clang writes a trace next to
+# the object file, in which each instantiation is an event.
+def count_instantiations_in(command, stderr)
+  case "@CMAKE_CXX_COMPILER_ID@"
+  when "GNU"
+    counts = stderr.scan(/(?:decl|type)_specializations: size \d+, (\d+) elements/)
+    counts.empty? ? nil : counts.flatten.map(&:to_i).inject(:+)
+  when "Clang", "AppleClang"
+    output = command[command.index("-o") + 1] if command.include?("-o")
+    return nil if output.nil?
+    trace = output.sub(/\.[^.\/]*\z/, "") + ".json"
+    return nil if not File.exist?(trace)
+    JSON.parse(File.read(trace))["traceEvents"].count { |event|
+      ["InstantiateClass", "InstantiateFunction"].include?(event["name"])
+    }
+  end
+end
+
+# aspect must be one of :compilation_time, :peak_memory, :instantiations,
+# :bloat, :execution_time
 def measure(aspect, template_relative, range, env = {})
   measure_file = Pathname.new("#{MEASURE_FILE}")
   template = Pathname.new(template_relative).expand_path
@@ -91,7 +147,9 @@ def measure(aspect, template_relative, range, env = {})
 
   make = -> (target) {
     command = "@CMAKE_COMMAND@ --build @CMAKE_BINARY_DIR@ --target #{target}"
-    stdout, stderr, status = Open3.capture3(command)
+    launcher_env = {}
+    launcher_env["BOOST_HANA_COUNT_INSTANTIATIONS"] = "1" if aspect == :instantiations
+    stdout, stderr, status = Open3.capture3(launcher_env, command)
   }
 
   progress = ProgressBar.create(format: '%p%% %t | %B |',
@@ -121,6 +179,17 @@ def measure(aspect, template_relative, range, env = {})
     stat = ctime.captures[0].to_f if aspect == :compilation_time
     stat = size if aspect == :bloat
 
+    if aspect == :peak_memory || aspect == :instantiations
+      label = aspect == :peak_memory ? "peak memory" : "instantiations"
+      match = stdout.match(/\[#{label}: (.+)\]/i)
+      if match.nil?
+        raise ("Could not find [#{label}: ...] bit in the output. This " +
+               "aspect may not be supported by the compiler or the platform. " +
+               "stdout follows:\n#{stdout}")
+      end
+      stat = match.captures[0].to_f
+    end
+
     # Run the resulting program and get timing statistics. The statistics
     # should be written to stdout by the `measure` function of the
     # `measure.hpp` header.
@@ -152,10 +221,35 @@ def time_compilation(erb_file, range, env = {})
   measure(:compilation_time, erb_file, range, env)
 end
 
+def peak_memory(erb_file, range, env = {})
+  measure(:peak_memory, erb_file, range, env)
+end
+
+def count_instantiations(erb_file, range, env = {})
+  measure(:instantiations, erb_file, range, env)
+end
+
 if __FILE__ == $0
-  command = ARGV.join(' ')
-  time = Benchmark.realtime { `#{command}` }
+  command = ARGV.dup
+  counting = ENV["BOOST_HANA_COUNT_INSTANTIATIONS"] && instantiation_flags
+  command += instantiation_flags if counting
+
+  stdout, stderr, status = nil
+  time = Benchmark.realtime {
+    stdout, stderr, status = Open3.capture3(command.join(' '))
+  }
+  # The statistics printed by the compiler are not diagnostics.
+  STDERR.write(stderr) if !counting || !status.success?
+  exit status.exitstatus || 1 if not status.success?
 
-  puts "[command line: #{command}]"
+  puts "[command line: #{command.join(' ')}]"
   puts "[compilation time: #{time}]"
+
+  memory = children_peak_memory
+  puts "[peak memory: #{memory}]" if memory
+
+  if counting
+    instantiations = count_instantiations_in(command, stderr)
+    puts "[instantiations: #{instantiations}]" if instantiations
+  end
 end
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/monadic_fold_left.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// Validates the elements one by one, and fails on the first zero.
+struct validate {
+    template <typename State, typename X>
+    constexpr auto operator()(State, X x) const {
+        return hana::if_(x == hana::int_c<0>,
+            hana::nothing,
+            hana::just(hana::int_c<State::value + X::value>)
+        );
+    }
+};
+
+int main() {
+    constexpr auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| "hana::int_c<#{i == 1 ? 1 : i}>" }.join(', ') %>
+    );
+
+    auto result = hana::monadic_fold_left<hana::optional_tag>(
+        xs, hana::int_c<0>, validate{}
+    );
+    (void)result;
+}
@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+
+
+int main() {
+    // Keys inserted in a scrambled order
+    constexpr auto m = boost::hana::make_ordered_map(
+        <%= (0...input_size).map { |n| k = (n * 67) % input_size
+              "boost::hana::make_pair(boost::hana::int_c<#{k}>, #{k})" }.join(', ') %>
+    );
+
+    int sum = 0;
+    boost::hana::for_each(boost::hana::keys(m), [&](auto key) {
+        sum += m[key];
+    });
+    (void)sum;
+}
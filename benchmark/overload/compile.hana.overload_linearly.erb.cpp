@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/functional/overload_linearly.hpp>
+
+
+template <int i>
+struct x { };
+
+template <int i>
+struct f {
+    constexpr int operator()(x<i>) const { return i; }
+};
+
+int main() {
+    constexpr auto overloaded = boost::hana::overload_linearly(
+        <%= (1..input_size).map { |n| "f<#{n}>{}" }.join(', ') %>
+    );
+
+    constexpr int result = overloaded(x<<%= input_size %>>{});
+    (void)result;
+}
@@ -0,0 +1,17 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/parse.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto path = BOOST_HANA_STRING(
+        "<%= (1..input_size).map { |i| "segment#{i}" }.join('/') %>"
+    );
+
+    auto result = hana::experimental::split(path, hana::experimental::ch<'/'>);
+    (void)result;
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+struct split_step {
+    template <typename State, typename C>
+    constexpr auto operator()(State state, C c) const {
+        return hana::if_(c == hana::char_c<'/'>,
+            hana::make_pair(hana::append(hana::first(state), hana::second(state)),
+                            hana::string<>{}),
+            hana::make_pair(hana::first(state),
+                            hana::second(state) + hana::string<C::value>{})
+        );
+    }
+};
+
+int main() {
+    auto path = BOOST_HANA_STRING(
+        "<%= (1..input_size).map { |i| "segment#{i}" }.join('/') %>"
+    );
+
+    auto pieces = hana::fold_left(path,
+        hana::make_pair(hana::make_tuple(), hana::string<>{}), split_step{});
+    auto result = hana::append(hana::first(pieces), hana::second(pieces));
+    (void)result;
+}
@@ -0,0 +1,13 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/functional/placeholder.hpp>
+
+
+int main() {
+    using boost::hana::_;
+    constexpr auto f = _ <%= (1..input_size).map { |n| "* #{n % 3 + 1} + #{n}" }.join(' ') %>;
+    constexpr int result = f(1);
+    (void)result;
+}
@@ -0,0 +1,11 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+int main() {
+    auto f = [](auto x) {
+        return x <%= (1..input_size).map { |n| "* #{n % 3 + 1} + #{n}" }.join(' ') %>;
+    };
+    int result = f(1);
+    (void)result;
+}
@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <string>
+
+
+int main() {
+    auto names = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "std::string(#{n % 4 + 1}, 'x')" }.join(', ') %>
+    );
+    // Long enough not to benefit from the small string optimization.
+    std::string key(64, 'x');
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += boost::hana::count_if(names, [&key](auto const& x) { return x == key; });
+        }
+        return result;
+    });
+}
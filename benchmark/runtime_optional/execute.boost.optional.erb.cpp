@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/optional.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main() {
+    boost::hana::benchmark::measure([] {
+        auto step = [](boost::optional<int> const& x) -> boost::optional<int> {
+            if (!x)
+                return boost::none;
+            return *x % 7 != 0 ? boost::optional<int>{*x / 2 + 3} : boost::none;
+        };
+
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto r = <%= 'step(' * input_size %>boost::optional<int>{std::rand()}<%= ')' * input_size %>;
+            result += r.value_or(0);
+        }
+        return result;
+    });
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/chain.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/runtime_optional.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main() {
+    boost::hana::benchmark::measure([] {
+        // Every other step can't fail, and says so in its return type
+        auto step = [](int x) {
+            return x % 7 != 0 ? boost::hana::runtime_optional<int>{x / 2 + 3}
+                              : boost::hana::runtime_optional<int>{};
+        };
+        auto safe_step = [](int x) {
+            return boost::hana::just(x / 2 + 3);
+        };
+
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto r = boost::hana::make_runtime_optional(std::rand())
+                <%= input_size.times.map { |n| n.even? ? ' | step' : ' | safe_step' }.join %>;
+            result += r.value_or(0);
+        }
+        return result;
+    });
+}
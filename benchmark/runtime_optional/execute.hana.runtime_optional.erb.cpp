@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/chain.hpp>
+#include <boost/hana/runtime_optional.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main() {
+    boost::hana::benchmark::measure([] {
+        auto step = [](int x) {
+            return x % 7 != 0 ? boost::hana::runtime_optional<int>{x / 2 + 3}
+                              : boost::hana::runtime_optional<int>{};
+        };
+
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto r = boost::hana::make_runtime_optional(std::rand())
+                <%= ' | step' * input_size %>;
+            result += r.value_or(0);
+        }
+        return result;
+    });
+}
@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <optional>
+
+
+int main() {
+    boost::hana::benchmark::measure([] {
+        auto step = [](std::optional<int> const& x) -> std::optional<int> {
+            if (!x)
+                return std::nullopt;
+            return *x % 7 != 0 ? std::optional<int>{*x / 2 + 3} : std::nullopt;
+        };
+
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto r = <%= 'step(' * input_size %>std::optional<int>{std::rand()}<%= ')' * input_size %>;
+            result += r.value_or(0);
+        }
+        return result;
+    });
+}
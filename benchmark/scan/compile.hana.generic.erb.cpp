@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/scan_left.hpp>
+#include <boost/hana/scan_right.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// Not recognized by the constexpr loop, so the scans apply it one step
+// at a time.
+struct f {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return hana::plus(x, y); }
+};
+
+int main() {
+    constexpr auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |i| "hana::int_c<#{i}>" }.join(', ') %>
+    );
+
+    auto left = hana::scan_left(xs, hana::int_c<0>, f{});
+    auto right = hana::scan_right(xs, hana::int_c<0>, f{});
+    (void)left; (void)right;
+}
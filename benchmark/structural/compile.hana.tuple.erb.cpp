@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/insert_range.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/prepend.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/remove_range.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/take_back.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct x { };
+
+int main() {
+    auto xs = boost::hana::make_tuple(
+        <%= (0...input_size).map { |i| "x<#{i}>{}" }.join(', ') %>
+    );
+
+    auto r0 = boost::hana::append(xs, x<-1>{});
+    auto r1 = boost::hana::prepend(xs, x<-1>{});
+    auto r2 = boost::hana::concat(xs, xs);
+    auto r3 = boost::hana::insert(xs, boost::hana::size_c<<%= input_size / 2 %>>, x<-1>{});
+    auto r4 = boost::hana::insert_range(xs, boost::hana::size_c<<%= input_size / 2 %>>, boost::hana::make_tuple(x<-1>{}, x<-2>{}));
+    auto r5 = boost::hana::remove_at(xs, boost::hana::size_c<<%= input_size / 2 %>>);
+    auto r6 = boost::hana::remove_range(xs, boost::hana::size_c<<%= input_size / 4 %>>, boost::hana::size_c<<%= input_size / 2 %>>);
+    auto r7 = boost::hana::slice(xs, boost::hana::range_c<std::size_t, <%= input_size / 4 %>, <%= input_size / 2 %>>);
+    auto r8 = boost::hana::reverse(xs);
+    auto r9 = boost::hana::take_back(xs, boost::hana::size_c<<%= input_size / 2 %>>);
+    auto r10 = boost::hana::drop_back(xs, boost::hana::size_c<<%= input_size / 2 %>>);
+    (void)r0; (void)r1; (void)r2; (void)r3; (void)r4; (void)r5; (void)r6; (void)r7; (void)r8; (void)r9; (void)r10;
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/prepend.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+int main () {
+    std::string s(1000, 'x');
+    hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            auto values = hana::make_tuple(
+                <%= input_size.times.map { 's' }.join(', ') %>
+            );
+
+            // The generic implementations for Sequences are selected by
+            // `when<true>`, since `hana::tuple` is a Sequence.
+            auto appended = hana::append_impl<hana::tuple_tag, hana::when<true>>::apply(std::move(values), s);
+            auto prepended = hana::prepend_impl<hana::tuple_tag, hana::when<true>>::apply(std::move(appended), s);
+            auto inserted = hana::insert_impl<hana::tuple_tag, hana::when<true>>::apply(std::move(prepended), hana::size_c<<%= input_size / 2 %>>, s);
+            auto concatenated = hana::concat_impl<hana::tuple_tag, hana::when<true>>::apply(std::move(inserted), hana::make_tuple(s, s));
+            auto result = hana::reverse_impl<hana::tuple_tag, hana::when<true>>::apply(std::move(concatenated));
+            (void)result;
+        }
+    });
+}
@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+<% 4.times do |i| %>
+struct component<%= i %> { double value; };
+<% end %>
+
+int main () {
+    boost::hana::benchmark::measure([&] {
+        boost::hana::map<
+            <%= (0...4).map { |i| "boost::hana::pair<boost::hana::type<component#{i}>, std::vector<component#{i}>>" }.join(",\n            ") %>
+        > components;
+
+        for (int i = 0; i != <%= input_size %>; ++i) {
+            <% 4.times do |i| %>
+            boost::hana::at_key(components, boost::hana::type_c<component<%= i %>>)
+                .push_back(component<%= i %>{static_cast<double>(std::rand())});
+            <% end %>
+        }
+
+        double result = 0;
+        boost::hana::for_each(components, [&](auto const& p) {
+            for (auto const& c : boost::hana::second(p))
+                result += c.value;
+        });
+        return result;
+    });
+}
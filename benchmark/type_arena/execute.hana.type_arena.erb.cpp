@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/type_arena.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+<% 4.times do |i| %>
+struct component<%= i %> { double value; };
+<% end %>
+
+int main () {
+    boost::hana::benchmark::measure([&] {
+        boost::hana::experimental::type_arena<
+            <%= (0...4).map { |i| "component#{i}" }.join(', ') %>
+        > components;
+
+        for (int i = 0; i != <%= input_size %>; ++i) {
+            <% 4.times do |i| %>
+            components.emplace(boost::hana::type_c<component<%= i %>>,
+                component<%= i %>{static_cast<double>(std::rand())});
+            <% end %>
+        }
+
+        double result = 0;
+        components.for_each_type([&](auto chunk) {
+            chunk.for_each([&](auto const& c) { result += c.value; });
+        });
+        return result;
+    });
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unfold_left.hpp>
+namespace hana = boost::hana;
+
+
+struct f {
+    template <typename I>
+    constexpr auto operator()(I i) const {
+        return hana::if_(i < hana::int_c<<%= input_size %>>,
+            hana::just(hana::make_pair(i + hana::int_c<1>, i)),
+            hana::nothing
+        );
+    }
+};
+
+int main() {
+    auto xs = hana::unfold_left<hana::tuple_tag>(hana::int_c<0>, f{});
+    (void)xs;
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/unroll.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+
+
+int main () {
+    constexpr std::size_t n = <%= input_size %>;
+    double xs[n + 1], ys[n + 1];
+    for (std::size_t i = 0; i != n; ++i) {
+        xs[i] = std::rand();
+        ys[i] = std::rand();
+    }
+
+    boost::hana::benchmark::measure([&] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::unroll<n, 8>([&](std::size_t i, auto) {
+                result += xs[i] * ys[i];
+            });
+        }
+        return result;
+    });
+}
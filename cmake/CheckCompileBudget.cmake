@@ -0,0 +1,148 @@
+# Copyright Louis Dionne 2013-2017
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This script compares the compile-time costs recorded by `compile_monitor`
+# against a budget, or updates the budget with the recorded costs. See the
+# `CompileBudget.cmake` module for the format of the files. It is meant to
+# be run as
+#
+#   cmake -DBUDGET=<file> -DLOG=<file> [-DTOLERANCE=<percent>] [-DUPDATE=ON]
+#         -P CheckCompileBudget.cmake
+#
+# When a target was compiled several times, only its latest cost is used.
+# Small absolute differences (less than half a second or 10MB) are never
+# reported as regressions, since they are usually just noise. A recorded
+# target that is missing from the budget is an error, so that new targets
+# are covered as soon as they are added.
+
+if (NOT EXISTS "${LOG}")
+    message(FATAL_ERROR
+        "No compile-time costs were recorded in '${LOG}'. Configure with "
+        "-DBOOST_HANA_ENABLE_COMPILE_MONITOR=ON and rebuild the tests first.")
+endif()
+
+if (NOT TOLERANCE)
+    set(TOLERANCE 25)
+endif()
+
+# Parses a line of the form `<target> <seconds> <kilobytes>` and sets
+# <prefix>_target, <prefix>_time (in milliseconds) and <prefix>_memory
+# (in kilobytes) in the parent scope.
+function(parse_cost prefix line)
+    string(REGEX MATCH "^([^ ]+) ([0-9]+)(\\.([0-9]+))? ([0-9]+)$" _match "${line}")
+    if (NOT _match)
+        set(${prefix}_target "" PARENT_SCOPE)
+        return()
+    endif()
+    string(SUBSTRING "${CMAKE_MATCH_4}000" 0 3 _millis)
+    math(EXPR _time "${CMAKE_MATCH_2} * 1000 + ${_millis}")
+    set(${prefix}_target "${CMAKE_MATCH_1}" PARENT_SCOPE)
+    set(${prefix}_time "${_time}" PARENT_SCOPE)
+    set(${prefix}_memory "${CMAKE_MATCH_5}" PARENT_SCOPE)
+endfunction()
+
+# Read the measured costs
+set(targets)
+file(STRINGS "${LOG}" _lines)
+foreach(_line IN LISTS _lines)
+    parse_cost(_cost "${_line}")
+    if (_cost_target)
+        list(APPEND targets ${_cost_target})
+        set(time_${_cost_target} ${_cost_time})
+        set(memory_${_cost_target} ${_cost_memory})
+    endif()
+endforeach()
+list(REMOVE_DUPLICATES targets)
+
+##############################################################################
+# Update the budget
+##############################################################################
+if (UPDATE)
+    # Sort by decreasing compilation time, by sorting zero-padded keys.
+    set(_keys)
+    foreach(_target IN LISTS targets)
+        string(LENGTH "${time_${_target}}" _length)
+        math(EXPR _padding "12 - ${_length}")
+        string(RANDOM LENGTH ${_padding} ALPHABET 0 _zeros)
+        list(APPEND _keys "${_zeros}${time_${_target}}|${_target}")
+    endforeach()
+    list(SORT _keys)
+    list(REVERSE _keys)
+
+    set(_contents "# Compile-time budget: <target> <time in seconds> <peak memory in kilobytes>\n")
+    foreach(_key IN LISTS _keys)
+        string(REGEX REPLACE "^[0-9]+\\|" "" _target "${_key}")
+        math(EXPR _seconds "${time_${_target}} / 1000")
+        math(EXPR _millis "${time_${_target}} % 1000 + 1000")
+        string(SUBSTRING "${_millis}" 1 3 _millis)
+        string(APPEND _contents "${_target} ${_seconds}.${_millis} ${memory_${_target}}\n")
+    endforeach()
+    file(WRITE "${BUDGET}" "${_contents}")
+    list(LENGTH targets _count)
+    message(STATUS "Wrote the budget of ${_count} targets to ${BUDGET}")
+    return()
+endif()
+
+##############################################################################
+# Check against the budget
+##############################################################################
+if (NOT EXISTS "${BUDGET}")
+    message(FATAL_ERROR "The budget file '${BUDGET}' does not exist.")
+endif()
+
+set(_regressions 0)
+set(_budgeted)
+file(STRINGS "${BUDGET}" _lines REGEX "^[^#]")
+foreach(_line IN LISTS _lines)
+    parse_cost(_budget "${_line}")
+    if (NOT _budget_target)
+        continue()
+    endif()
+    list(APPEND _budgeted ${_budget_target})
+    if (NOT DEFINED time_${_budget_target})
+        continue()
+    endif()
+    set(_target ${_budget_target})
+
+    math(EXPR _max_time "${_budget_time} * (100 + ${TOLERANCE}) / 100")
+    math(EXPR _time_slack "${_budget_time} + 500")
+    if (_time_slack GREATER _max_time)
+        set(_max_time ${_time_slack})
+    endif()
+    if (time_${_target} GREATER _max_time)
+        message(WARNING "${_target}: compilation time went from "
+                        "${_budget_time}ms to ${time_${_target}}ms")
+        math(EXPR _regressions "${_regressions} + 1")
+    endif()
+
+    math(EXPR _max_memory "${_budget_memory} * (100 + ${TOLERANCE}) / 100")
+    math(EXPR _memory_slack "${_budget_memory} + 10240")
+    if (_memory_slack GREATER _max_memory)
+        set(_max_memory ${_memory_slack})
+    endif()
+    if (memory_${_target} GREATER _max_memory)
+        message(WARNING "${_target}: peak memory usage went from "
+                        "${_budget_memory}kB to ${memory_${_target}}kB")
+        math(EXPR _regressions "${_regressions} + 1")
+    endif()
+endforeach()
+
+set(_missing 0)
+foreach(_target IN LISTS targets)
+    list(FIND _budgeted ${_target} _index)
+    if (_index EQUAL -1)
+        message(WARNING "${_target}: no compile-time budget; it was compiled "
+                        "in ${time_${_target}}ms using ${memory_${_target}}kB")
+        math(EXPR _missing "${_missing} + 1")
+    endif()
+endforeach()
+
+if (_regressions GREATER 0 OR _missing GREATER 0)
+    message(FATAL_ERROR "${_regressions} compile-time budget regression(s) "
+                        "above the ${TOLERANCE}% tolerance were found, and "
+                        "${_missing} recorded target(s) have no budget. Run "
+                        "the <prefix>.budget.update target if these costs are expected.")
+endif()
+message(STATUS "All the recorded targets are within their compile-time budget.")
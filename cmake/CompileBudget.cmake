@@ -0,0 +1,147 @@
+# Copyright Louis Dionne 2013-2017
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This CMake module provides functions to record the compile-time cost of
+# targets, to compare these costs against a checked-in budget, and to split
+# targets into shards of roughly equal cost.
+#
+# The budget is a text file containing one line per target, of the form
+#
+#   <target> <compilation time in seconds> <peak memory usage in kilobytes>
+#
+# where lines starting with `#` are ignored. It is sorted by decreasing
+# compilation time, and it can be regenerated from the costs measured
+# during a build using the `<prefix>.budget.update` target created by
+# `boost_hana_add_compile_budget`.
+
+set(_BOOST_HANA_COMPILE_BUDGET_DIR "${CMAKE_CURRENT_LIST_DIR}")
+
+
+#   boost_hana_monitor_compilation(<target> <log file>)
+#
+# Compiles all the sources of the given target through the `compile_monitor`
+# launcher, which appends the compilation time and peak memory usage of the
+# target to the given log file. This only works with the Makefile and Ninja
+# generators, since others do not support the `RULE_LAUNCH_COMPILE` property.
+function(boost_hana_monitor_compilation target log)
+    if (NOT TARGET boost_hana_compile_monitor)
+        add_executable(boost_hana_compile_monitor EXCLUDE_FROM_ALL
+            "${_BOOST_HANA_COMPILE_BUDGET_DIR}/compile_monitor.cpp")
+        set_target_properties(boost_hana_compile_monitor PROPERTIES
+            RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}")
+    endif()
+
+    set(_monitor "${CMAKE_BINARY_DIR}/boost_hana_compile_monitor${CMAKE_EXECUTABLE_SUFFIX}")
+    set_target_properties(${target} PROPERTIES
+        RULE_LAUNCH_COMPILE "\"${_monitor}\" \"${log}\" \"${target}\"")
+    add_dependencies(${target} boost_hana_compile_monitor)
+endfunction()
+
+
+#   boost_hana_add_compile_budget(<prefix> BUDGET <file> LOG <file> [TOLERANCE <percent>])
+#
+# Creates two targets:
+#   <prefix>.budget.check
+#       Compares the costs recorded in the LOG file to the BUDGET file, and
+#       fails if a target exceeds its budget by more than TOLERANCE percent
+#       (25% by default) in compilation time or in peak memory usage, or if
+#       a recorded target has no budget.
+#
+#   <prefix>.budget.update
+#       Rewrites the BUDGET file with the costs recorded in the LOG file.
+function(boost_hana_add_compile_budget prefix)
+    cmake_parse_arguments(ARGS "" "BUDGET;LOG;TOLERANCE" "" ${ARGN})
+    if (NOT ARGS_TOLERANCE)
+        set(ARGS_TOLERANCE 25)
+    endif()
+
+    set(_script "${_BOOST_HANA_COMPILE_BUDGET_DIR}/CheckCompileBudget.cmake")
+    add_custom_target(${prefix}.budget.check
+        COMMAND ${CMAKE_COMMAND} -DBUDGET=${ARGS_BUDGET}
+                                 -DLOG=${ARGS_LOG}
+                                 -DTOLERANCE=${ARGS_TOLERANCE}
+                                 -P ${_script}
+        COMMENT "Checking the compile-time budget of ${prefix}"
+        VERBATIM USES_TERMINAL)
+
+    add_custom_target(${prefix}.budget.update
+        COMMAND ${CMAKE_COMMAND} -DBUDGET=${ARGS_BUDGET}
+                                 -DLOG=${ARGS_LOG}
+                                 -DUPDATE=ON
+                                 -P ${_script}
+        COMMENT "Updating the compile-time budget of ${prefix}"
+        VERBATIM USES_TERMINAL)
+endfunction()
+
+
+#   boost_hana_shard_targets(<prefix> SHARDS <count> BUDGET <file> TARGETS targets...)
+#
+# Splits the given targets into <count> custom targets named `<prefix>.shard<k>`
+# (with k in [1, count]) of roughly equal compilation cost, and labels the
+# corresponding tests with `shard<k>` so they can be run with `ctest -L`.
+#
+# The cost of each target is taken from the BUDGET file. Targets are assigned
+# greedily to the cheapest shard, starting with the most expensive ones. The
+# targets that are not in the budget are reported, assumed to cost as much as
+# the cheapest target in the budget, and assigned last.
+function(boost_hana_shard_targets prefix)
+    cmake_parse_arguments(ARGS "" "SHARDS;BUDGET" "TARGETS" ${ARGN})
+
+    set(_ordered)
+    set(_default_cost 1000)
+    if (EXISTS "${ARGS_BUDGET}")
+        file(STRINGS "${ARGS_BUDGET}" _lines REGEX "^[^#]")
+        foreach(_line IN LISTS _lines)
+            string(REGEX MATCH "^([^ ]+) ([0-9]+)(\\.([0-9]+))? " _match "${_line}")
+            if (NOT _match)
+                continue()
+            endif()
+            set(_target "${CMAKE_MATCH_1}")
+            string(SUBSTRING "${CMAKE_MATCH_4}000" 0 3 _millis)
+            math(EXPR _cost "${CMAKE_MATCH_2} * 1000 + ${_millis}")
+            if (_target IN_LIST ARGS_TARGETS)
+                set(_cost_${_target} ${_cost})
+                list(APPEND _ordered ${_target})
+                set(_default_cost ${_cost})
+            endif()
+        endforeach()
+    endif()
+
+    set(_missing)
+    foreach(_target IN LISTS ARGS_TARGETS)
+        if (NOT DEFINED _cost_${_target})
+            set(_cost_${_target} ${_default_cost})
+            list(APPEND _ordered ${_target})
+            list(APPEND _missing ${_target})
+        endif()
+    endforeach()
+    if (_missing)
+        list(LENGTH _missing _count)
+        string(REPLACE ";" ", " _missing "${_missing}")
+        message(WARNING "${_count} target(s) have no compile-time budget in "
+                        "'${ARGS_BUDGET}', so the shards may be unbalanced: "
+                        "${_missing}")
+    endif()
+
+    foreach(_shard RANGE 1 ${ARGS_SHARDS})
+        set(_load_${_shard} 0)
+        add_custom_target(${prefix}.shard${_shard}
+            COMMENT "Build the shard ${_shard} of ${ARGS_SHARDS} of ${prefix}.")
+    endforeach()
+
+    foreach(_target IN LISTS _ordered)
+        set(_best 1)
+        foreach(_shard RANGE 1 ${ARGS_SHARDS})
+            if (_load_${_shard} LESS _load_${_best})
+                set(_best ${_shard})
+            endif()
+        endforeach()
+        math(EXPR _load_${_best} "${_load_${_best}} + ${_cost_${_target}}")
+        add_dependencies(${prefix}.shard${_best} ${_target})
+        if (TEST ${_target})
+            set_property(TEST ${_target} APPEND PROPERTY LABELS shard${_best})
+        endif()
+    endforeach()
+endfunction()
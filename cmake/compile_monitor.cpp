@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+//
+//
+// Compiler launcher recording the cost of each compilation.
+//
+// Usage: compile_monitor <log file> <name> <command> [args...]
+//
+// This program runs the given command, and then appends a line of the form
+//
+//      <name> <wall time in seconds> <peak resident memory in kilobytes>
+//
+// to the log file. The exit status of the command is returned unchanged, so
+// this program can be used transparently as a `RULE_LAUNCH_COMPILE` in CMake.
+// On platforms where the peak memory usage can't be retrieved, 0 is recorded.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#if defined(_WIN32)
+#   include <process.h>
+#else
+#   include <sys/resource.h>
+#   include <sys/time.h>
+#   include <sys/types.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::fprintf(stderr, "usage: %s <log file> <name> <command> [args...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char const* log_file = argv[1];
+    char const* name = argv[2];
+    char** command = argv + 3;
+
+    auto start = std::chrono::steady_clock::now();
+    long max_rss_kb = 0;
+    int status = EXIT_FAILURE;
+
+#if defined(_WIN32)
+    status = static_cast<int>(_spawnvp(_P_WAIT, command[0], command));
+    if (status == -1) {
+        std::perror(command[0]);
+        return EXIT_FAILURE;
+    }
+#else
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return EXIT_FAILURE;
+    } else if (pid == 0) {
+        execvp(command[0], command);
+        std::perror(command[0]);
+        _exit(127);
+    }
+
+    int wait_status = 0;
+    struct rusage usage;
+    if (wait4(pid, &wait_status, 0, &usage) < 0) {
+        std::perror("wait4");
+        return EXIT_FAILURE;
+    }
+#   if defined(__APPLE__)
+    max_rss_kb = usage.ru_maxrss / 1024; // bytes on Darwin
+#   else
+    max_rss_kb = usage.ru_maxrss;
+#   endif
+    if (WIFEXITED(wait_status))
+        status = WEXITSTATUS(wait_status);
+    else
+        status = 128 + WTERMSIG(wait_status);
+#endif
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Only successful compilations are recorded, since failures would
+    // otherwise show up as spurious improvements.
+    if (status == 0) {
+        if (std::FILE* log = std::fopen(log_file, "a")) {
+            std::fprintf(log, "%s %.3f %ld\n", name, elapsed.count(), max_rss_kb);
+            std::fclose(log);
+        }
+    }
+
+    return status;
+}
@@ -14,11 +14,35 @@
       };
     }
 
+    // A series can set its `aspect` to plot something else than time. Each
+    // aspect gets its own axis, and the axes after the first one are drawn
+    // on the right of the chart.
+    var aspects = {
+        'time': { title: "Time (s)", suffix: 's' }
+      , 'peak_memory': { title: "Peak memory usage (MB)", suffix: 'MB' }
+      , 'instantiations': { title: "Template instantiations", suffix: '' }
+    };
     if (options.yAxis == undefined) {
-      options.yAxis = {
-        title: { text: "Time (s)" },
-        floor: 0
-      };
+      var axes = [];
+      options.series.forEach(function(series) {
+        var aspect = series.aspect || 'time';
+        if (axes.indexOf(aspect) == -1)
+          axes.push(aspect);
+        series.yAxis = axes.indexOf(aspect);
+        series.tooltip = series.tooltip || { valueSuffix: aspects[aspect].suffix };
+      });
+      if (axes.length == 0)
+        axes.push('time');
+
+      options.yAxis = axes.map(function(aspect, index) {
+        return {
+          title: { text: aspects[aspect].title },
+          floor: 0,
+          opposite: index > 0
+        };
+      });
+      if (options.yAxis.length == 1)
+        options.yAxis = options.yAxis[0];
     }
 
     if (options.subtitle == undefined) {
@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/difference.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/union.hpp>
+namespace hana = boost::hana;
+
+
+// Feature flags known at compile-time
+constexpr auto enabled = hana::bitset_c<int, 0, 3, 5, 42>;
+constexpr auto required = hana::bitset_c<int, 3, 42>;
+constexpr auto experimental = hana::bitset_c<int, 5, 63>;
+
+BOOST_HANA_CONSTANT_CHECK(hana::intersection(enabled, required) == required);
+BOOST_HANA_CONSTANT_CHECK(hana::difference(enabled, experimental) == hana::bitset_c<int, 0, 3, 42>);
+BOOST_HANA_CONSTANT_CHECK(hana::union_(required, experimental) == hana::bitset_c<int, 3, 5, 42, 63>);
+BOOST_HANA_CONSTANT_CHECK(hana::contains(enabled, hana::int_c<5>));
+
+// Bitsets can be converted to and from hana::set
+BOOST_HANA_CONSTANT_CHECK(
+    hana::to<hana::set_tag>(required) == hana::make_set(hana::int_c<42>, hana::int_c<3>)
+);
+BOOST_HANA_CONSTANT_CHECK(
+    hana::to<hana::bitset_tag>(hana::make_set(hana::int_c<42>, hana::int_c<3>)) == required
+);
+
+int main() { }
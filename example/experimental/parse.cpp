@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parse.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+namespace ex = hana::experimental;
+
+
+// A tiny subset of SQL: `SELECT column FROM table`
+auto identifier = ex::seq(ex::alpha, ex::many(ex::alt(ex::alnum, ex::ch<'_'>)));
+auto spaces = ex::some(ex::space);
+auto query = ex::seq(
+    BOOST_HANA_STRING("SELECT"), spaces, ex::capture(identifier),
+    spaces, BOOST_HANA_STRING("FROM"), spaces, ex::capture(identifier)
+);
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(
+        ex::parse(BOOST_HANA_STRING("SELECT name FROM users"), query)
+            ==
+        hana::just(hana::make_tuple(BOOST_HANA_STRING("name"),
+                                    BOOST_HANA_STRING("users")))
+    );
+
+    BOOST_HANA_CONSTANT_CHECK(
+        ex::parse(BOOST_HANA_STRING("SELECT FROM users"), query) == hana::nothing
+    );
+
+    BOOST_HANA_CONSTANT_CHECK(
+        ex::split(BOOST_HANA_STRING("users/:id/posts"), ex::ch<'/'>)
+            ==
+        hana::make_tuple(BOOST_HANA_STRING("users"),
+                         BOOST_HANA_STRING(":id"),
+                         BOOST_HANA_STRING("posts"))
+    );
+}
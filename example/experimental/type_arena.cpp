@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/experimental/type_arena.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+struct Position { float x, y; };
+struct Velocity { float dx, dy; };
+
+int main() {
+    hana::experimental::type_arena<Position, Velocity> components{16};
+
+    auto p = components.emplace(hana::type_c<Position>, Position{0, 0});
+    auto v = components.emplace(hana::type_c<Velocity>, Velocity{1, 2});
+    components.emplace(hana::type_c<Position>, Position{5, 5});
+
+    // Handles are stable, even if the arena grows.
+    components[p].x += components[v].dx;
+    components.reserve(1000);
+    BOOST_HANA_RUNTIME_CHECK(components[p].x == 1);
+
+    // The chunk of a type is found at compile-time.
+    auto positions = hana::at_key(components, hana::type_c<Position>);
+    BOOST_HANA_RUNTIME_CHECK(positions.size() == 2);
+
+    float sum = 0;
+    positions.for_each([&](Position const& pos) { sum += pos.x; });
+    BOOST_HANA_RUNTIME_CHECK(sum == 6);
+
+    // Erasing an object does not move the other ones.
+    components.erase(p);
+    BOOST_HANA_RUNTIME_CHECK(positions.size() == 1);
+}
@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto line = hana::format(BOOST_HANA_STRING("{}: {} of {} done ({{ok}})"));
+
+    char buffer[64];
+    char* end = line(buffer, buffer + sizeof(buffer), "upload", 3, 10u);
+    BOOST_HANA_RUNTIME_CHECK(end != nullptr);
+    BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == "upload: 3 of 10 done ({ok})");
+
+    // When the buffer is too small, nullptr is returned.
+    char small[8];
+    BOOST_HANA_RUNTIME_CHECK(line(small, small + sizeof(small), "upload", 3, 10u) == nullptr);
+}
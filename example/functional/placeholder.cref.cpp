@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    auto names = hana::make_tuple("Alice"s, "Bob"s, "Carol"s, "Bob"s);
+    std::string key = "Bob";
+
+    // `key` is not copied into the predicate
+    BOOST_HANA_RUNTIME_CHECK(hana::count_if(names, hana::_ == hana::cref(key)) == 2);
+
+    // composed expressions can capture by reference too
+    std::string exclaimed = "Bob!";
+    BOOST_HANA_RUNTIME_CHECK(hana::count_if(names, hana::_ + "!" == hana::cref(exclaimed)) == 2);
+}
@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/monadic_fold_left.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+// Adds the sizes of types, and fails on incomplete types. Since the fold
+// stops at `void`, `sizeof` is never applied to the types that follow it.
+struct add_size {
+    template <typename Total, typename T>
+    constexpr auto operator()(Total, hana::basic_type<T>) const {
+        return hana::just(hana::size_c<Total::value + sizeof(T)>);
+    }
+
+    template <typename Total>
+    constexpr auto operator()(Total, hana::basic_type<void>) const {
+        return hana::nothing;
+    }
+};
+
+struct incomplete;
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::monadic_fold_left<hana::optional_tag>(
+        hana::tuple_t<char, char>, hana::size_c<0>, add_size{}
+    ) == hana::just(hana::size_c<2>)
+);
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::monadic_fold_left<hana::optional_tag>(
+        hana::tuple_t<char, void, incomplete>, hana::size_c<0>, add_size{}
+    ) == hana::nothing
+);
+
+int main() { }
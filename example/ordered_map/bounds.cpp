@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+constexpr auto m = hana::make_ordered_map(
+    hana::make_pair(hana::int_c<30>, hana::type_c<long>),
+    hana::make_pair(hana::int_c<10>, hana::type_c<char>),
+    hana::make_pair(hana::int_c<20>, hana::type_c<int>)
+);
+
+static_assert(hana::lower_bound(m, hana::int_c<20>) == hana::size_c<1>, "");
+static_assert(hana::upper_bound(m, hana::int_c<20>) == hana::size_c<2>, "");
+static_assert(hana::lower_bound(m, hana::int_c<25>) == hana::size_c<2>, "");
+static_assert(hana::upper_bound(m, hana::int_c<25>) == hana::size_c<2>, "");
+
+int main() { }
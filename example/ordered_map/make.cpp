@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(
+        hana::make_ordered_map(
+            hana::make_pair(hana::int_c<2>, "foobar"s),
+            hana::make_pair(hana::int_c<1>, "baz"s)
+        )
+        ==
+        hana::make<hana::ordered_map_tag>(
+            hana::make_pair(hana::int_c<1>, "baz"s),
+            hana::make_pair(hana::int_c<2>, "foobar"s)
+        )
+    );
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+// Registers are listed in any order, but they are always visited in
+// increasing order of their address, which makes the generated code
+// deterministic.
+int main() {
+    auto registers = hana::make_ordered_map(
+        hana::make_pair(hana::int_c<0x20>, "status"s),
+        hana::make_pair(hana::int_c<0x00>, "control"s),
+        hana::make_pair(hana::int_c<0x10>, "data"s)
+    );
+
+    std::string layout;
+    hana::for_each(registers, [&](auto const& reg) {
+        layout += hana::second(reg) + ";";
+    });
+    BOOST_HANA_RUNTIME_CHECK(layout == "control;data;status;");
+
+    BOOST_HANA_RUNTIME_CHECK(registers[hana::int_c<0x10>] == "data");
+}
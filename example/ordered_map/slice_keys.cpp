@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+constexpr auto m = hana::make_ordered_map(
+    hana::make_pair(hana::int_c<8>, hana::type_c<long long>),
+    hana::make_pair(hana::int_c<1>, hana::type_c<char>),
+    hana::make_pair(hana::int_c<4>, hana::type_c<int>),
+    hana::make_pair(hana::int_c<2>, hana::type_c<short>)
+);
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::slice_keys(m, hana::int_c<2>, hana::int_c<8>)
+        ==
+    hana::make_ordered_map(
+        hana::make_pair(hana::int_c<2>, hana::type_c<short>),
+        hana::make_pair(hana::int_c<4>, hana::type_c<int>)
+    )
+);
+
+int main() { }
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/runtime_optional.hpp>
+
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+// Whether parsing succeeds is only known at runtime
+hana::runtime_optional<int> parse_digit(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    return {};
+}
+
+int main() {
+    auto twice = [](int x) { return hana::just(2 * x); };
+    auto fail = [](int) { return hana::nothing; };
+
+    auto ok = hana::just('4') | parse_digit | twice;
+    BOOST_HANA_RUNTIME_CHECK(ok.has_value() && *ok == 8);
+
+    auto bad = hana::just('x') | parse_digit | twice;
+    BOOST_HANA_RUNTIME_CHECK(!bad.has_value());
+
+    // When a step is known to fail at compile-time, the result is `nothing`
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        parse_digit(static_cast<char>(std::rand())) | fail,
+        hana::nothing
+    ));
+}
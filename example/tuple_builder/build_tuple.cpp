@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/traits.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+// Keep the elements that are not pointers, without creating an intermediate
+// tuple at each step.
+auto push_non_pointer = [](auto&& builder, auto const& x) {
+    return hana::if_(hana::traits::is_pointer(hana::typeid_(x)),
+        builder,
+        hana::push_back(builder, x)
+    );
+};
+
+int main() {
+    int i = 0;
+    auto xs = hana::make_tuple(1, &i, 'x', "abc"s);
+    auto ys = hana::build_tuple(xs, push_non_pointer);
+
+    BOOST_HANA_RUNTIME_CHECK(ys == hana::make_tuple(1, 'x', "abc"s));
+}
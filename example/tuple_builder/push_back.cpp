@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    std::string abc = "abc";
+
+    // `abc` is copied into the tuple, and "def"s is moved into it. Neither
+    // is copied nor moved by `push_back` itself.
+    auto xs = hana::to_tuple(
+        hana::push_back(hana::push_back(hana::make_tuple_builder(), abc), "def"s)
+    );
+
+    BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple("abc"s, "def"s));
+}
@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+namespace hana = boost::hana;
+
+
+// The builder refers to the temporaries `1` and `'2'`, so it is converted
+// to a tuple in the expression that creates it.
+static_assert(hana::to_tuple(
+    hana::push_back(hana::push_back(hana::make_tuple_builder(), 1), '2')
+) == hana::make_tuple(1, '2'), "");
+
+int main() { }
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/unroll.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+int main() {
+    int xs[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Everything is unrolled; `i` and `k` are the same index.
+    int sum = 0;
+    hana::unroll<10>([&](std::size_t i, auto k) {
+        static_assert(decltype(k)::value < 10, "");
+        sum += xs[i];
+    });
+    BOOST_HANA_RUNTIME_CHECK(sum == 45);
+
+    // Blocks of 4 calls, executed twice by a loop, followed by the last 2
+    // calls; `k` is the offset of `i` in its block.
+    int offsets = 0;
+    hana::unroll<10, 4>([&](std::size_t i, auto k) {
+        BOOST_HANA_RUNTIME_CHECK(i % 4 == decltype(k)::value);
+        offsets += decltype(k)::value;
+    });
+    BOOST_HANA_RUNTIME_CHECK(offsets == (0 + 1 + 2 + 3) * 2 + (0 + 1));
+
+    // Every other index, i.e. 0, 2, 4, 6 and 8.
+    int evens = 0;
+    hana::unroll<10, 2>(hana::size_c<2>, [&](std::size_t i, auto) {
+        evens += xs[i];
+    });
+    BOOST_HANA_RUNTIME_CHECK(evens == 20);
+}
@@ -72,6 +72,7 @@ namespace boost {
 #include <boost/hana/at_key.hpp>
 #include <boost/hana/back.hpp>
 #include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bitset.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/cartesian_product.hpp>
 #include <boost/hana/chain.hpp>
@@ -108,6 +109,7 @@ namespace boost {
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fold_right.hpp>
 #include <boost/hana/for_each.hpp>
+#include <boost/hana/format.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional.hpp>
 #include <boost/hana/fuse.hpp>
@@ -151,6 +153,7 @@ namespace boost {
 #include <boost/hana/one.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
+#include <boost/hana/ordered_map.hpp>
 #include <boost/hana/ordering.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/partition.hpp>
@@ -171,6 +174,7 @@ namespace boost {
 #include <boost/hana/replicate.hpp>
 #include <boost/hana/reverse.hpp>
 #include <boost/hana/reverse_fold.hpp>
+#include <boost/hana/runtime_optional.hpp>
 #include <boost/hana/scan_left.hpp>
 #include <boost/hana/scan_right.hpp>
 #include <boost/hana/second.hpp>
@@ -191,12 +195,14 @@ namespace boost {
 #include <boost/hana/traits.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
 #include <boost/hana/type.hpp>
 #include <boost/hana/unfold_left.hpp>
 #include <boost/hana/unfold_right.hpp>
 #include <boost/hana/union.hpp>
 #include <boost/hana/unique.hpp>
 #include <boost/hana/unpack.hpp>
+#include <boost/hana/unroll.hpp>
 #include <boost/hana/value.hpp>
 #include <boost/hana/version.hpp>
 #include <boost/hana/while.hpp>
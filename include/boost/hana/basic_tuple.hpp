@@ -15,15 +15,27 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/ebo.hpp>
+#include <boost/hana/detail/tuple_algorithms.hpp>
+#include <boost/hana/fwd/append.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/bool.hpp>
+#include <boost/hana/fwd/concat.hpp>
 #include <boost/hana/fwd/concept/sequence.hpp>
 #include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/drop_back.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/insert_range.hpp>
 #include <boost/hana/fwd/integral_constant.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/prepend.hpp>
+#include <boost/hana/fwd/remove_at.hpp>
+#include <boost/hana/fwd/remove_range.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/slice.hpp>
+#include <boost/hana/fwd/take_back.hpp>
 #include <boost/hana/fwd/transform.hpp>
 #include <boost/hana/fwd/unpack.hpp>
 
@@ -251,6 +263,49 @@ BOOST_HANA_NAMESPACE_BEGIN
             return hana::size_t<sizeof...(Xn)>{};
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structural algorithms
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct tuple_access<basic_tuple_tag> {
+            template <typename Xs>
+            static constexpr Xs&& storage(Xs&& xs)
+            { return static_cast<Xs&&>(xs); }
+
+            template <typename ...Xn>
+            static constexpr basic_tuple<typename detail::decay<Xn>::type...>
+            make(Xn&& ...xn) {
+                return basic_tuple<typename detail::decay<Xn>::type...>{
+                    static_cast<Xn&&>(xn)...
+                };
+            }
+        };
+    }
+
+    template <>
+    struct append_impl<basic_tuple_tag> : detail::tuple_append<basic_tuple_tag> { };
+    template <>
+    struct prepend_impl<basic_tuple_tag> : detail::tuple_prepend<basic_tuple_tag> { };
+    template <>
+    struct concat_impl<basic_tuple_tag> : detail::tuple_concat<basic_tuple_tag> { };
+    template <>
+    struct insert_impl<basic_tuple_tag> : detail::tuple_insert<basic_tuple_tag> { };
+    template <>
+    struct insert_range_impl<basic_tuple_tag> : detail::tuple_insert_range<basic_tuple_tag> { };
+    template <>
+    struct remove_at_impl<basic_tuple_tag> : detail::tuple_remove_at<basic_tuple_tag> { };
+    template <>
+    struct remove_range_impl<basic_tuple_tag> : detail::tuple_remove_range<basic_tuple_tag> { };
+    template <>
+    struct slice_impl<basic_tuple_tag> : detail::tuple_slice<basic_tuple_tag> { };
+    template <>
+    struct reverse_impl<basic_tuple_tag> : detail::tuple_reverse<basic_tuple_tag> { };
+    template <>
+    struct take_back_impl<basic_tuple_tag> : detail::tuple_take_back<basic_tuple_tag> { };
+    template <>
+    struct drop_back_impl<basic_tuple_tag> : detail::tuple_drop_back<basic_tuple_tag> { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_BASIC_TUPLE_HPP
@@ -0,0 +1,508 @@
+/*!
+@file
+Defines `boost::hana::bitset`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BITSET_HPP
+#define BOOST_HANA_BITSET_HPP
+
+#include <boost/hana/fwd/bitset.hpp>
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/searchable.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/fwd/difference.hpp>
+#include <boost/hana/fwd/erase_key.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/intersection.hpp>
+#include <boost/hana/fwd/symmetric_difference.hpp>
+#include <boost/hana/fwd/union.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_subset.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/or.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/value.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace bitset_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Computations on the words of a bitset
+        //
+        // A sequence of words is represented by a type `W` with a static
+        // `size` and a static constexpr `at(i)` function returning the i-th
+        // word, or 0 past the end. The result of an operation is computed
+        // lazily word by word, and then materialized as the parameters of
+        // a `bitset` with trailing zero words removed.
+        //////////////////////////////////////////////////////////////////////
+        template <std::uint64_t ...w>
+        struct words {
+            static constexpr std::size_t size = sizeof...(w);
+
+            static constexpr std::uint64_t at(std::size_t i) {
+                std::uint64_t const ws[] = {w..., 0};
+                return i < sizeof...(w) ? ws[i] : 0;
+            }
+        };
+
+        template <std::uint64_t ...keys>
+        constexpr std::size_t words_for() {
+            std::uint64_t const ks[] = {keys..., 0};
+            std::size_t n = 0;
+            for (std::size_t k = 0; k < sizeof...(keys); ++k)
+                if (ks[k] / 64 + 1 > n)
+                    n = ks[k] / 64 + 1;
+            return n;
+        }
+
+        template <std::uint64_t ...keys>
+        struct key_words {
+            static constexpr std::size_t size = words_for<keys...>();
+
+            static constexpr std::uint64_t at(std::size_t i) {
+                std::uint64_t const ks[] = {keys..., 0};
+                std::uint64_t w = 0;
+                for (std::size_t k = 0; k < sizeof...(keys); ++k)
+                    if (ks[k] / 64 == i)
+                        w |= std::uint64_t{1} << (ks[k] % 64);
+                return w;
+            }
+        };
+
+        struct word_or {
+            static constexpr std::uint64_t apply(std::uint64_t a, std::uint64_t b)
+            { return a | b; }
+        };
+
+        struct word_and {
+            static constexpr std::uint64_t apply(std::uint64_t a, std::uint64_t b)
+            { return a & b; }
+        };
+
+        struct word_and_not {
+            static constexpr std::uint64_t apply(std::uint64_t a, std::uint64_t b)
+            { return a & ~b; }
+        };
+
+        struct word_xor {
+            static constexpr std::uint64_t apply(std::uint64_t a, std::uint64_t b)
+            { return a ^ b; }
+        };
+
+        template <typename Op, typename W1, typename W2>
+        struct combine {
+            static constexpr std::size_t size = W1::size > W2::size ? W1::size
+                                                                     : W2::size;
+
+            static constexpr std::uint64_t at(std::size_t i)
+            { return Op::apply(W1::at(i), W2::at(i)); }
+        };
+
+        template <typename W>
+        constexpr std::size_t trimmed_size() {
+            std::size_t n = W::size;
+            while (n > 0 && W::at(n - 1) == 0)
+                --n;
+            return n;
+        }
+
+        constexpr std::size_t popcount(std::uint64_t w) {
+            std::size_t n = 0;
+            for (; w != 0; w &= w - 1)
+                ++n;
+            return n;
+        }
+
+        template <typename W>
+        constexpr std::size_t count() {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < W::size; ++i)
+                n += bitset_detail::popcount(W::at(i));
+            return n;
+        }
+
+        // Returns the n-th smallest key of the bitset.
+        template <typename W>
+        constexpr std::uint64_t nth_key(std::size_t n) {
+            for (std::size_t i = 0; i < W::size; ++i) {
+                std::uint64_t w = W::at(i);
+                std::size_t const c = bitset_detail::popcount(w);
+                if (n >= c) {
+                    n -= c;
+                    continue;
+                }
+                for (std::size_t b = 0; ; ++b, w >>= 1)
+                    if ((w & 1) && n-- == 0)
+                        return i * 64 + b;
+            }
+            return 0;
+        }
+
+        template <typename W>
+        constexpr bool test(std::uint64_t key)
+        { return (W::at(key / 64) >> (key % 64)) & 1; }
+
+        // Equivalent to `v < 0`, without warnings for unsigned types.
+        template <typename T>
+        constexpr bool negative(T v)
+        { return !(v > T{}) && v != T{}; }
+
+        template <typename T, typename W, std::size_t ...i>
+        bitset<T, W::at(i)...> from_words_impl(std::index_sequence<i...>);
+
+        template <typename T, typename W>
+        using from_words = decltype(bitset_detail::from_words_impl<T, W>(
+            std::make_index_sequence<bitset_detail::trimmed_size<W>()>{}
+        ));
+
+        template <typename T, T ...v>
+        struct from_keys {
+            static_assert(std::is_integral<T>::value,
+            "hana::bitset_c<T, v...> requires 'T' to be an integral type");
+
+            static_assert(detail::fast_and<!bitset_detail::negative(v)...>::value,
+            "hana::bitset_c<T, v...> requires the 'v...' to be non-negative");
+
+            using type = from_words<T, key_words<static_cast<std::uint64_t>(v)...>>;
+        };
+
+        template <typename B>
+        struct traits;
+
+        template <typename T, std::uint64_t ...w>
+        struct traits<bitset<T, w...>> {
+            using value_type = T;
+            using words = bitset_detail::words<w...>;
+        };
+
+        template <typename X>
+        using words_of = typename traits<typename detail::decay<X>::type>::words;
+
+        template <typename X>
+        using value_type_of = typename traits<typename detail::decay<X>::type>::value_type;
+
+        // Whether a key can be looked up by testing a bit of the bitset,
+        // i.e. whether it is an IntegralConstant.
+        template <typename Key>
+        using is_bit = hana::integral_constant<bool,
+            hana::IntegralConstant<typename detail::decay<Key>::type>::value
+        >;
+
+        template <typename Key>
+        constexpr bool is_negative()
+        { return bitset_detail::negative(hana::value<typename detail::decay<Key>::type>()); }
+
+        template <typename Key>
+        constexpr std::uint64_t key_of()
+        { return static_cast<std::uint64_t>(hana::value<typename detail::decay<Key>::type>()); }
+
+        template <typename W, typename Key>
+        constexpr bool contains_key()
+        { return !is_negative<Key>() && test<W>(key_of<Key>()); }
+
+        template <typename Op, typename Xs, typename Ys>
+        using binary_op = from_words<
+            typename std::common_type<value_type_of<Xs>, value_type_of<Ys>>::type,
+            combine<Op, words_of<Xs>, words_of<Ys>>
+        >;
+
+        template <typename Op, typename Xs, typename Key>
+        constexpr auto with_key() {
+            static_assert(hana::IntegralConstant<typename detail::decay<Key>::type>::value,
+            "hana::insert(bitset, key) and hana::erase_key(bitset, key) require "
+            "'key' to be an IntegralConstant");
+
+            static_assert(!is_negative<Key>(),
+            "hana::insert(bitset, key) and hana::erase_key(bitset, key) require "
+            "'key' to be non-negative");
+
+            return from_words<value_type_of<Xs>,
+                combine<Op, words_of<Xs>, key_words<key_of<Key>()>>
+            >{};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // bitset
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename T, std::uint64_t ...Words>
+    struct bitset final
+        : detail::operators::adl<bitset<T, Words...>>
+        , detail::searchable_operators<bitset<T, Words...>>
+    {
+        static_assert(std::is_integral<T>::value,
+        "hana::bitset<T, ...> requires 'T' to be an integral type");
+
+        using hana_tag = bitset_tag;
+        using value_type = T;
+        static constexpr std::size_t size =
+            bitset_detail::count<bitset_detail::words<Words...>>();
+    };
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<bitset_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // make<bitset_tag>
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<bitset_tag> {
+        static constexpr auto apply()
+        { return bitset<int>{}; }
+
+        template <typename ...Keys>
+        static constexpr auto apply(Keys&& ...) {
+            static_assert(detail::fast_and<bitset_detail::is_bit<Keys>::value...>::value,
+            "hana::make_bitset(keys...) requires all the 'keys' to be IntegralConstants");
+
+            static_assert(detail::fast_and<!bitset_detail::is_negative<Keys>()...>::value,
+            "hana::make_bitset(keys...) requires all the 'keys' to be non-negative");
+
+            using T = typename std::common_type<
+                typename detail::decay<decltype(
+                    hana::value<typename detail::decay<Keys>::type>()
+                )>::type...
+            >::type;
+
+            return bitset_detail::from_words<T, bitset_detail::key_words<
+                bitset_detail::key_of<Keys>()...
+            >>{};
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<bitset_tag, bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&) {
+            return hana::bool_c<std::is_same<
+                bitset_detail::words_of<Xs>, bitset_detail::words_of<Ys>
+            >::value>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<bitset_tag> {
+        template <typename T, typename W, typename F, std::size_t ...i>
+        static constexpr decltype(auto) unpack_helper(F&& f, std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                hana::integral_c<T, static_cast<T>(bitset_detail::nth_key<W>(i))>...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&&, F&& f) {
+            using T = bitset_detail::value_type_of<Xs>;
+            using W = bitset_detail::words_of<Xs>;
+            return unpack_helper<T, W>(static_cast<F&&>(f),
+                std::make_index_sequence<bitset_detail::count<W>()>{});
+        }
+    };
+
+    template <>
+    struct length_impl<bitset_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&) {
+            return hana::size_c<bitset_detail::count<bitset_detail::words_of<Xs>>()>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<bitset_tag> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return hana::find_if(hana::unpack(static_cast<Xs&&>(xs), hana::make_tuple),
+                                 static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct any_of_impl<bitset_tag> {
+        template <typename Pred>
+        struct any_of_helper {
+            Pred const& pred;
+            template <typename ...X>
+            constexpr auto operator()(X const& ...x) const {
+                return hana::or_(pred(x)...);
+            }
+            constexpr auto operator()() const {
+                return hana::false_c;
+            }
+        };
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const& pred) {
+            return hana::unpack(xs, any_of_helper<Pred>{pred});
+        }
+    };
+
+    template <>
+    struct contains_impl<bitset_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto helper(Xs const&, Key const&, hana::true_) {
+            return hana::bool_c<bitset_detail::contains_key<
+                bitset_detail::words_of<Xs>, Key
+            >()>;
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto helper(Xs const& xs, Key const& key, hana::false_)
+        { return hana::any_of(xs, hana::equal.to(key)); }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const& xs, Key const& key) {
+            return contains_impl::helper(xs, key, bitset_detail::is_bit<Key>{});
+        }
+    };
+
+    template <>
+    struct find_impl<bitset_tag> {
+        template <typename T, typename Key>
+        static constexpr auto found(Key const&, hana::true_)
+        { return hana::just(hana::integral_c<T, static_cast<T>(hana::value<Key>())>); }
+
+        template <typename T, typename Key>
+        static constexpr auto found(Key const&, hana::false_)
+        { return hana::nothing; }
+
+        template <typename Xs, typename Key>
+        static constexpr auto helper(Xs const&, Key const& key, hana::true_) {
+            return find_impl::found<bitset_detail::value_type_of<Xs>>(key,
+                hana::bool_c<bitset_detail::contains_key<
+                    bitset_detail::words_of<Xs>, Key
+                >()>);
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto helper(Xs const& xs, Key const& key, hana::false_)
+        { return hana::find_if(xs, hana::equal.to(key)); }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const& xs, Key const& key) {
+            return find_impl::helper(xs, key, bitset_detail::is_bit<Key>{});
+        }
+    };
+
+    template <>
+    struct is_subset_impl<bitset_tag, bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&) {
+            using Extra = bitset_detail::combine<bitset_detail::word_and_not,
+                bitset_detail::words_of<Xs>, bitset_detail::words_of<Ys>
+            >;
+            return hana::bool_c<bitset_detail::trimmed_size<Extra>() == 0>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversions
+    //////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    struct to_impl<bitset_tag, F, when<hana::Foldable<F>::value>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs)
+        { return hana::unpack(static_cast<Xs&&>(xs), hana::make_bitset); }
+    };
+
+    template <>
+    struct to_impl<set_tag, bitset_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs)
+        { return hana::unpack(static_cast<Xs&&>(xs), hana::make_set); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // insert and erase_key
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct insert_impl<bitset_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const&, Key const&) {
+            return bitset_detail::with_key<bitset_detail::word_or, Xs, Key>();
+        }
+    };
+
+    template <>
+    struct erase_key_impl<bitset_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const&, Key const&) {
+            return bitset_detail::with_key<bitset_detail::word_and_not, Xs, Key>();
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Set operations
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct union_impl<bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&)
+        { return bitset_detail::binary_op<bitset_detail::word_or, Xs, Ys>{}; }
+    };
+
+    template <>
+    struct intersection_impl<bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&)
+        { return bitset_detail::binary_op<bitset_detail::word_and, Xs, Ys>{}; }
+    };
+
+    template <>
+    struct difference_impl<bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&)
+        { return bitset_detail::binary_op<bitset_detail::word_and_not, Xs, Ys>{}; }
+    };
+
+    template <>
+    struct symmetric_difference_impl<bitset_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const&, Ys const&)
+        { return bitset_detail::binary_op<bitset_detail::word_xor, Xs, Ys>{}; }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_BITSET_HPP
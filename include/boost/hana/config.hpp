@@ -144,6 +144,16 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONSTEXPR_LAMBDA /* nothing */
 #endif
 
+// `BOOST_HANA_ALWAYS_INLINE` marks a function that should be inlined even
+// when the optimizer would rather not, e.g. because the function is large.
+#if defined(BOOST_HANA_CONFIG_CLANG) || defined(BOOST_HANA_CONFIG_GCC)
+#   define BOOST_HANA_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#   define BOOST_HANA_ALWAYS_INLINE __forceinline
+#else
+#   define BOOST_HANA_ALWAYS_INLINE inline
+#endif
+
 // There's a bug in std::tuple_cat in libc++ right now.
 // See http://llvm.org/bugs/show_bug.cgi?id=22806.
 #if defined(BOOST_HANA_CONFIG_LIBCPP)
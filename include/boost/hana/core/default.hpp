@@ -18,15 +18,14 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 BOOST_HANA_NAMESPACE_BEGIN
+    // A Method is a default implementation if it has `default_` as a public
+    // and unambiguous base. This is checked with a conversion of pointers
+    // instead of converting a Method to default_ with SFINAE, which is
+    // cheaper since is_default is checked for every model of every concept.
+    // Unlike std::is_base_of, this also accepts an incomplete Method, which
+    // is not a default implementation.
     template <typename Method, typename>
-    struct is_default : std::false_type { };
-
-    template <typename Method>
-    struct is_default<Method, decltype((void)
-        static_cast<default_>(*(Method*)0)
-    )>
-        : std::true_type
-    { };
+    struct is_default : std::is_convertible<Method*, default_*> { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_CORE_DEFAULT_HPP
@@ -39,11 +39,20 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = typename T::hana_tag;
     };
 
+    // All the reference and cv-qualified variants of a type forward directly
+    // to the unqualified type, so that `tag_of<T const&>` does not need to go
+    // through `tag_of<T const>` first.
     template <typename T> struct tag_of<T const> : tag_of<T> { };
     template <typename T> struct tag_of<T volatile> : tag_of<T> { };
     template <typename T> struct tag_of<T const volatile> : tag_of<T> { };
     template <typename T> struct tag_of<T&> : tag_of<T> { };
+    template <typename T> struct tag_of<T const&> : tag_of<T> { };
+    template <typename T> struct tag_of<T volatile&> : tag_of<T> { };
+    template <typename T> struct tag_of<T const volatile&> : tag_of<T> { };
     template <typename T> struct tag_of<T&&> : tag_of<T> { };
+    template <typename T> struct tag_of<T const&&> : tag_of<T> { };
+    template <typename T> struct tag_of<T volatile&&> : tag_of<T> { };
+    template <typename T> struct tag_of<T const volatile&&> : tag_of<T> { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_CORE_TAG_OF_HPP
@@ -16,7 +16,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/count_if.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -39,11 +45,37 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename T, bool condition>
     struct count_impl<T, when<condition>> : default_ {
-        template <typename Xs, typename Value>
-        static constexpr auto apply(Xs&& xs, Value&& value) {
+        template <typename Xs, typename Elements, typename Value, typename U>
+        static constexpr auto
+        apply_impl(Xs&& xs, Elements, Value&& value, U const*) {
             return hana::count_if(static_cast<Xs&&>(xs),
                 hana::equal.to(static_cast<Value&&>(value)));
         }
+
+        // When all the elements are `integral_constant`s of the same type
+        // as the value, the elements equal to the value are counted with a
+        // `constexpr` loop over their values. The overload is selected with
+        // the decayed type of the value, so that it does not depend on the
+        // value being an rvalue, or a const or non-const lvalue.
+        template <typename Xs, typename V, V ...v, typename Value, V x>
+        static constexpr auto
+        apply_impl(Xs&&, std::integer_sequence<V, v...>, Value&&,
+                   hana::integral_constant<V, x> const*)
+        {
+            constexpr V values[] = {v...};
+            return hana::size_c<detail::count(values, values + sizeof...(v), x)>;
+        }
+
+        template <typename Xs, typename Value>
+        static constexpr auto apply(Xs&& xs, Value&& value) {
+            using Elements = typename detail::integral_elements<
+                typename detail::decay<Xs>::type
+            >::type;
+            using U = typename detail::decay<Value>::type;
+            return count_impl::apply_impl(static_cast<Xs&&>(xs), Elements{},
+                                          static_cast<Value&&>(value),
+                                          static_cast<U const*>(nullptr));
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
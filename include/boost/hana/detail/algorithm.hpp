@@ -181,6 +181,19 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
                 smallest = first;
         return smallest;
     }
+
+    template <typename ForwardIt>
+    constexpr ForwardIt max_element(ForwardIt first, ForwardIt last) {
+        if (first == last)
+            return last;
+
+        ForwardIt largest = first;
+        ++first;
+        for (; first != last; ++first)
+            if (*largest < *first)
+                largest = first;
+        return largest;
+    }
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_ALGORITHM_HPP
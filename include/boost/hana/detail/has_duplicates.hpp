@@ -10,11 +10,14 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
 #define BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
 
+#include <boost/hana/concept/hashable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -32,6 +35,70 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         return c;
     }
 
+    template <typename Hash, std::size_t i>
+    struct hash_entry { };
+
+    template <typename ...Entries>
+    struct hash_entries : Entries... { };
+
+    // Deduction fails when more than one `hash_entry` has the given `Hash`.
+    template <typename Hash, std::size_t i>
+    std::integral_constant<std::size_t, i> unique_hash(hash_entry<Hash, i> const&);
+
+    template <typename T>
+    using hash_of = typename decltype(hana::hash(std::declval<T>()))::type;
+
+    template <bool same_hash, typename T, typename U>
+    struct equal_if_same_hash : std::false_type { };
+
+    template <typename T, typename U>
+    struct equal_if_same_hash<true, T, U>
+        : std::integral_constant<bool,
+            decltype(hana::equal(std::declval<T>(), std::declval<U>()))::value
+        >
+    { };
+
+    template <bool hashable, typename Indices, typename ...T>
+    struct has_duplicates_impl;
+
+    template <typename ...T, std::size_t ...i>
+    struct has_duplicates_impl<false, std::index_sequence<i...>, T...> {
+        static constexpr bool value =
+            !detail::fast_and<(detail::pack_count<T, T...>() == 1)...>::value;
+    };
+
+    template <typename ...T, std::size_t ...i>
+    struct has_duplicates_impl<true, std::index_sequence<i...>, T...> {
+        using Table = hash_entries<hash_entry<hash_of<T>, i>...>;
+
+        template <typename Hash, typename = decltype(
+            detail::unique_hash<Hash>(std::declval<Table const&>())
+        )>
+        static std::false_type shares_hash(int);
+
+        template <typename Hash>
+        static std::true_type shares_hash(long);
+
+        template <std::size_t k, typename Tk>
+        static constexpr bool equal_to_other(std::false_type)
+        { return false; }
+
+        template <std::size_t k, typename Tk>
+        static constexpr bool equal_to_other(std::true_type) {
+            constexpr bool equal[] = {false, (k != i && equal_if_same_hash<
+                std::is_same<hash_of<T>, hash_of<Tk>>::value, T, Tk
+            >::value)...};
+            for (bool e : equal)
+                if (e)
+                    return true;
+            return false;
+        }
+
+        static constexpr bool value = !detail::fast_and<
+            !equal_to_other<i, T>(decltype(shares_hash<hash_of<T>>(0)){})...
+        >::value;
+    };
+
     //! @ingroup group-details
     //! Returns whether any of the `T`s are duplicate w.r.t. `hana::equal`.
     //!
@@ -41,23 +108,20 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //! the comparison to return an `IntegralConstant` that can be explicitly
     //! converted to `bool`.
     //!
-    //! @note
-    //! Since this utility is mostly used in assertions to check that there
-    //! are no duplicates in a sequence, we expect it to return `false` most
-    //! of the time (otherwise we will assert). Hence, this implementation is
-    //! biased towards the fact that we __will__ have to compare every pair of
-    //! elements in most cases, and it does not try to be lazy.
-    //!
-    //! @todo
-    //! This implementation is O(n^2). We could do it in O(n), but that would
-    //! require a more elaborate setup including storage with O(1) lookup
-    //! (which could be based on a compile-time hash). If we implement such
-    //! storage for associative sequences, we could use it to optimize this.
+    //! When all the `T`s are `Hashable`, only the `T`s with the same hash
+    //! are compared, since equal objects must have equal hashes. The `T`s
+    //! whose hash is unique are found with a single overload resolution
+    //! against a class deriving from one `hash_entry` per `T`, so the check
+    //! requires `O(n)` instantiations when there are few collisions. When
+    //! some `T` is not `Hashable`, every pair of `T`s is compared instead,
+    //! which requires `O(n^2)` instantiations of `hana::equal`.
     template <typename ...T>
     struct has_duplicates {
-        static constexpr bool value =
-            sizeof...(T) > 0 &&
-            !detail::fast_and<(detail::pack_count<T, T...>() == 1)...>::value
+        static constexpr bool value = sizeof...(T) > 0 &&
+            has_duplicates_impl<
+                detail::fast_and<hana::Hashable<T>::value...>::value,
+                std::make_index_sequence<sizeof...(T)>, T...
+            >::value
         ;
     };
 } BOOST_HANA_NAMESPACE_END
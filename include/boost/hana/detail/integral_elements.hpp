@@ -0,0 +1,55 @@
+/*!
+@file
+Defines `boost::hana::detail::integral_elements`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_INTEGRAL_ELEMENTS_HPP
+#define BOOST_HANA_DETAIL_INTEGRAL_ELEMENTS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/integral_constant.hpp>
+#include <boost/hana/fwd/basic_tuple.hpp>
+#include <boost/hana/fwd/tuple.hpp>
+
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    struct not_integral_elements { };
+
+    //! @ingroup group-details
+    //! Returns the values held by a sequence of `integral_constant`s.
+    //!
+    //! If `S` is a non-empty `hana::tuple` or `hana::basic_tuple` whose
+    //! elements are all `hana::integral_constant<T, v>`s for the same `T`,
+    //! `integral_elements<S>::type` is `std::integer_sequence<T, v...>`.
+    //! Otherwise, it is `detail::not_integral_elements`.
+    //!
+    //! This is used by algorithms like `hana::maximum` or `hana::sort` to
+    //! compute their result with a `constexpr` loop over the values, instead
+    //! of comparing the elements one by one with `hana::less`. Algorithms
+    //! use it to select an overload, with something like
+    //! @code
+    //!     apply_impl(xs, typename integral_elements<S>::type{})
+    //! @endcode
+    template <typename S>
+    struct integral_elements {
+        using type = not_integral_elements;
+    };
+
+    template <typename T, T ...v>
+    struct integral_elements<hana::tuple<hana::integral_constant<T, v>...>> {
+        using type = std::integer_sequence<T, v...>;
+    };
+
+    template <typename T, T ...v>
+    struct integral_elements<hana::basic_tuple<hana::integral_constant<T, v>...>> {
+        using type = std::integer_sequence<T, v...>;
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_INTEGRAL_ELEMENTS_HPP
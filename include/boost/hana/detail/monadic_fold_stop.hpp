@@ -0,0 +1,126 @@
+/*!
+@file
+Defines `boost::hana::monadic_fold_stop_impl` and
+`boost::hana::detail::monadic_fold_stop`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_MONADIC_FOLD_STOP_HPP
+#define BOOST_HANA_DETAIL_MONADIC_FOLD_STOP_HPP
+
+#include <boost/hana/fwd/monadic_fold_left.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/functional/partial.hpp>
+#include <boost/hana/functional/reverse_partial.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    template <typename M, bool condition>
+    struct monadic_fold_stop_impl<M, when<condition>> : default_ { };
+
+    namespace detail {
+        template <bool left>
+        struct monadic_fold_continuation;
+
+        template <>
+        struct monadic_fold_continuation<true> {
+            template <typename F, typename X>
+            static constexpr auto apply(F& f, X const& x)
+            { return hana::reverse_partial(f, x); }
+        };
+
+        template <>
+        struct monadic_fold_continuation<false> {
+            template <typename F, typename X>
+            static constexpr auto apply(F& f, X const& x)
+            { return hana::partial(f, x); }
+        };
+
+        //! @ingroup group-details
+        //! Monadic fold for a Monad `M` providing `monadic_fold_stop_impl`.
+        //!
+        //! `xs` is a `basic_tuple` holding the elements of the structure. The
+        //! `k`-th step chains `f` partially applied to the `k`-th element (or
+        //! the `k`-th from the end for a right fold) to the state, unless all
+        //! the elements were processed or the state can't change anymore, in
+        //! which case the state is returned as-is. `run` performs 8 steps per
+        //! level of recursion, and it only recurses if the fold is not done,
+        //! so nothing is instantiated for the elements after the one that
+        //! made the fold stop.
+        template <typename M, bool left, typename Xs, typename F>
+        struct monadic_fold_stop {
+            static constexpr std::size_t n = Xs::size_;
+            Xs& xs;
+            F& f;
+
+            template <std::size_t k, typename State>
+            static constexpr auto proceed(State const& state) {
+                return hana::bool_c<(k < n) &&
+                    !decltype(monadic_fold_stop_impl<M>::apply(state))::value
+                >;
+            }
+
+            template <std::size_t k, typename State>
+            constexpr typename detail::decay<State>::type
+            step_impl(State&& state, hana::false_) const
+            { return static_cast<State&&>(state); }
+
+            template <std::size_t k, typename State>
+            constexpr auto step_impl(State&& state, hana::true_) const {
+                constexpr std::size_t i = left ? k : n - 1 - k;
+                return hana::chain(static_cast<State&&>(state),
+                    monadic_fold_continuation<left>::apply(f, hana::at_c<i>(xs))
+                );
+            }
+
+            template <std::size_t k, typename State>
+            constexpr auto step(State&& state) const {
+                return step_impl<k>(static_cast<State&&>(state),
+                                    proceed<k>(state));
+            }
+
+            template <std::size_t k, typename State>
+            constexpr typename detail::decay<State>::type
+            finish(State&& state, hana::false_) const
+            { return static_cast<State&&>(state); }
+
+            template <std::size_t k, typename State>
+            constexpr auto finish(State&& state, hana::true_) const
+            { return run<k>(static_cast<State&&>(state)); }
+
+            template <std::size_t k, typename State>
+            constexpr auto run(State&& state) const {
+                auto next = step<k + 7>(step<k + 6>(step<k + 5>(step<k + 4>(
+                            step<k + 3>(step<k + 2>(step<k + 1>(step<k>(
+                                static_cast<State&&>(state)
+                            ))))))));
+                return finish<k + 8>(std::move(next), proceed<k + 8>(next));
+            }
+        };
+
+        template <typename M, bool left, typename Xs, typename State, typename F>
+        constexpr auto monadic_fold_stop_apply(Xs&& xs, State&& state, F& f) {
+            auto elements = hana::unpack(static_cast<Xs&&>(xs),
+                                         hana::make_basic_tuple);
+            using Fold = detail::monadic_fold_stop<M, left, decltype(elements), F>;
+            return Fold{elements, f}.template run<0>(static_cast<State&&>(state));
+        }
+    }
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_MONADIC_FOLD_STOP_HPP
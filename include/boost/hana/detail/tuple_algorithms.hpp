@@ -0,0 +1,341 @@
+/*!
+@file
+Defines structural algorithms shared by `boost::hana::tuple` and
+`boost::hana::basic_tuple`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_TUPLE_ALGORITHMS_HPP
+#define BOOST_HANA_DETAIL_TUPLE_ALGORITHMS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/ebo.hpp>
+#include <boost/hana/fwd/basic_tuple.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+#include <boost/hana/fwd/range.hpp>
+#include <boost/hana/fwd/tuple.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //////////////////////////////////////////////////////////////////////////
+    // The generic implementations of the structural algorithms of Sequences
+    // go through `hana::make<S>(hana::at_c<i>(xs)...)`, and `insert` and
+    // `insert_range` are built from several of these passes. Since the
+    // elements of a `tuple` and a `basic_tuple` are stored in a `basic_tuple`
+    // whose layout is known, the implementations below pick the elements of
+    // the result directly from that storage, and build the result in a
+    // single pass that moves from the sources when they are rvalues.
+    //
+    // `tuple_access<S>` must provide
+    // - `storage(xs)`, which returns the `basic_tuple` holding the elements
+    //   of `xs`, with the same value category as `xs`.
+    // - `make(x...)`, which returns a container with tag `S` holding the
+    //   decayed `x...`, without checking whether they can be constructed.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct tuple_access;
+
+    template <std::size_t> struct bti; // basic_tuple_index
+
+    template <typename Xs>
+    struct tuple_length;
+
+    template <typename ...Xn>
+    struct tuple_length<hana::basic_tuple<Xn...>> {
+        static constexpr std::size_t value = sizeof...(Xn);
+    };
+
+    template <typename ...Xn>
+    struct tuple_length<hana::tuple<Xn...>> {
+        static constexpr std::size_t value = sizeof...(Xn);
+    };
+
+    template <typename Xs>
+    using tuple_length_of = tuple_length<typename detail::decay<Xs>::type>;
+
+    constexpr std::size_t tuple_min(std::size_t a, std::size_t b)
+    { return a < b ? a : b; }
+
+    template <typename S>
+    struct tuple_append {
+        template <typename Xs, typename X, std::size_t ...i>
+        static constexpr auto append_helper(Xs&& xs, X&& x, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<i>>(static_cast<Xs&&>(xs))..., static_cast<X&&>(x)
+            );
+        }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X&& x) {
+            return append_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                 static_cast<X&&>(x),
+                                 std::make_index_sequence<tuple_length_of<Xs>::value>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_prepend {
+        template <typename Xs, typename X, std::size_t ...i>
+        static constexpr auto prepend_helper(Xs&& xs, X&& x, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                static_cast<X&&>(x), detail::ebo_get<bti<i>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X&& x) {
+            return prepend_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                  static_cast<X&&>(x),
+                                  std::make_index_sequence<tuple_length_of<Xs>::value>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_concat {
+        template <typename Xs, typename Ys, std::size_t ...xi, std::size_t ...yi>
+        static constexpr auto
+        concat_helper(Xs&& xs, Ys&& ys, std::index_sequence<xi...>,
+                                        std::index_sequence<yi...>)
+        {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<xi>>(static_cast<Xs&&>(xs))...,
+                detail::ebo_get<bti<yi>>(static_cast<Ys&&>(ys))...
+            );
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            return concat_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                 tuple_access<S>::storage(static_cast<Ys&&>(ys)),
+                                 std::make_index_sequence<tuple_length_of<Xs>::value>{},
+                                 std::make_index_sequence<tuple_length_of<Ys>::value>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_insert {
+        template <typename Xs, typename X, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        insert_helper(Xs&& xs, X&& x, std::index_sequence<before...>,
+                                      std::index_sequence<after...>)
+        {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<before>>(static_cast<Xs&&>(xs))...,
+                static_cast<X&&>(x),
+                detail::ebo_get<bti<sizeof...(before) + after>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N, typename X>
+        static constexpr auto apply(Xs&& xs, N const&, X&& x) {
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            constexpr std::size_t n = detail::tuple_min(N::value, len);
+            return insert_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                 static_cast<X&&>(x),
+                                 std::make_index_sequence<n>{},
+                                 std::make_index_sequence<len - n>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_insert_range {
+        template <typename Xs, typename Ys, std::size_t ...before,
+                  std::size_t ...yi, std::size_t ...after>
+        static constexpr auto
+        insert_range_helper(Xs&& xs, Ys&& ys, std::index_sequence<before...>,
+                                              std::index_sequence<yi...>,
+                                              std::index_sequence<after...>)
+        {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<before>>(static_cast<Xs&&>(xs))...,
+                detail::ebo_get<bti<yi>>(static_cast<Ys&&>(ys))...,
+                detail::ebo_get<bti<sizeof...(before) + after>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N, typename Ys>
+        static constexpr auto insert(Xs&& xs, N const&, Ys&& ys) {
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            constexpr std::size_t n = detail::tuple_min(N::value, len);
+            return insert_range_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                       tuple_access<S>::storage(static_cast<Ys&&>(ys)),
+                                       std::make_index_sequence<n>{},
+                                       std::make_index_sequence<tuple_length_of<Ys>::value>{},
+                                       std::make_index_sequence<len - n>{});
+        }
+
+        template <typename Xs, typename N, typename Elements>
+        static constexpr auto apply(Xs&& xs, N const& n, Elements&& elements, std::true_type)
+        { return insert(static_cast<Xs&&>(xs), n, static_cast<Elements&&>(elements)); }
+
+        template <typename Xs, typename N, typename Elements>
+        static constexpr auto apply(Xs&& xs, N const& n, Elements&& elements, std::false_type)
+        { return insert(static_cast<Xs&&>(xs), n, hana::to<S>(static_cast<Elements&&>(elements))); }
+
+        template <typename Xs, typename N, typename Elements>
+        static constexpr auto apply(Xs&& xs, N const& n, Elements&& elements) {
+            return tuple_insert_range::apply(static_cast<Xs&&>(xs), n,
+                static_cast<Elements&&>(elements),
+                std::is_same<typename hana::tag_of<Elements>::type, S>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_remove_at {
+        template <typename Xs, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        remove_at_helper(Xs&& xs, std::index_sequence<before...>,
+                                  std::index_sequence<after...>)
+        {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<before>>(static_cast<Xs&&>(xs))...,
+                detail::ebo_get<bti<sizeof...(before) + 1 + after>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t n = N::value;
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            static_assert(n < len,
+            "hana::remove_at(xs, n) requires 'n' to be in the bounds of the sequence");
+            return remove_at_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                    std::make_index_sequence<n>{},
+                                    std::make_index_sequence<len - n - 1>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_remove_range {
+        template <std::size_t offset, typename Xs, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        remove_range_helper(Xs&& xs, std::index_sequence<before...>,
+                                     std::index_sequence<after...>)
+        {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<before>>(static_cast<Xs&&>(xs))...,
+                detail::ebo_get<bti<offset + after>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename From, typename To>
+        static constexpr auto apply(Xs&& xs, From const&, To const&) {
+            constexpr std::size_t from = From::value;
+            constexpr std::size_t to = To::value;
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            constexpr std::size_t before = from == to ? len : from;
+            constexpr std::size_t after = from == to ? 0 : len - to;
+            static_assert(from <= to,
+            "hana::remove_range(xs, from, to) requires '[from, to)' to be a "
+            "valid interval, meaning that 'from <= to'");
+            static_assert(from == to || to <= len,
+            "hana::remove_range(xs, from, to) requires 'to <= length(xs)'");
+            return remove_range_helper<to>(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                           std::make_index_sequence<before>{},
+                                           std::make_index_sequence<after>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_slice {
+        template <std::size_t from, typename Xs, std::size_t ...i>
+        static constexpr auto from_offset(Xs&& xs, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<from + i>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename T, T from, T to>
+        static constexpr auto apply(Xs&& xs, hana::range<T, from, to> const&) {
+            return from_offset<from>(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                     std::make_index_sequence<to - from>{});
+        }
+
+        // The same index may be given more than once, so we can't move
+        // from the elements of `xs`. See the generic `slice`.
+        template <typename Storage>
+        struct take_arbitrary {
+            Storage const& storage;
+
+            template <typename ...N>
+            constexpr auto operator()(N const& ...) const {
+                return tuple_access<S>::make(
+                    detail::ebo_get<bti<N::value>>(storage)...
+                );
+            }
+        };
+
+        template <typename Xs, typename Indices>
+        static constexpr auto apply(Xs const& xs, Indices const& indices) {
+            using Storage = typename detail::decay<
+                decltype(tuple_access<S>::storage(xs))
+            >::type;
+            return hana::unpack(indices,
+                take_arbitrary<Storage>{tuple_access<S>::storage(xs)});
+        }
+    };
+
+    template <typename S>
+    struct tuple_reverse {
+        template <typename Xs, std::size_t ...i>
+        static constexpr auto reverse_helper(Xs&& xs, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<sizeof...(i) - i - 1>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            return reverse_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                  std::make_index_sequence<tuple_length_of<Xs>::value>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_take_back {
+        template <std::size_t start, typename Xs, std::size_t ...i>
+        static constexpr auto take_back_helper(Xs&& xs, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<start + i>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            constexpr std::size_t n = detail::tuple_min(N::value, len);
+            return take_back_helper<len - n>(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                             std::make_index_sequence<n>{});
+        }
+    };
+
+    template <typename S>
+    struct tuple_drop_back {
+        template <typename Xs, std::size_t ...i>
+        static constexpr auto drop_back_helper(Xs&& xs, std::index_sequence<i...>) {
+            return tuple_access<S>::make(
+                detail::ebo_get<bti<i>>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t len = tuple_length_of<Xs>::value;
+            constexpr std::size_t n = detail::tuple_min(N::value, len);
+            return drop_back_helper(tuple_access<S>::storage(static_cast<Xs&&>(xs)),
+                                    std::make_index_sequence<len - n>{});
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_TUPLE_ALGORITHMS_HPP
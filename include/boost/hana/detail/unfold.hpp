@@ -0,0 +1,103 @@
+/*!
+@file
+Defines `boost::hana::detail::unfold`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_UNFOLD_HPP
+#define BOOST_HANA_DETAIL_UNFOLD_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    template <typename Builder, typename Next>
+    struct unfold_status {
+        Builder builder;
+        Next next;
+    };
+
+    //! @ingroup group-details
+    //! Runs the generator of `unfold_left` or `unfold_right`, and returns
+    //! `k` applied to a `tuple_builder` holding the produced elements in the
+    //! order in which they were produced.
+    //!
+    //! `Element` and `Seed` are `hana::first_t` or `hana::second_t`, and
+    //! they extract the produced element and the next seed from the pair
+    //! returned by the generator.
+    //!
+    //! Since the type of the next seed depends on the result of the generator,
+    //! the steps can't be computed independently. Instead, each step extends
+    //! a `tuple_builder` with one element, which only instantiates one link,
+    //! and `run` performs 16 steps per level of recursion. The recursion only
+    //! stops once the generator returns `hana::nothing`, and the steps
+    //! performed after that do nothing. Hence, generating `n` elements
+    //! instantiates `O(n)` builder links for a recursion depth of `n / 16`,
+    //! instead of a recursion of depth `n` that creates a new sequence at
+    //! each step.
+    //!
+    //! Each link refers to the builder held by the previous status, and to
+    //! the element in the pair held by the previous status, so the statuses
+    //! are all temporaries of the expression that calls `k`. That way, each
+    //! element is only moved once, by `k`.
+    template <typename F, typename Element, typename Seed, typename K>
+    struct unfold {
+        F& f;
+        K const& k;
+
+        template <typename Builder, typename P>
+        constexpr auto step(unfold_status<Builder, hana::optional<P>>&& s) const {
+            P& p = *s.next;
+            using Link = detail::builder_link<Builder,
+                decltype(Element{}(static_cast<P&&>(p)))
+            >;
+            using Next = typename detail::decay<
+                decltype(f(Seed{}(static_cast<P&&>(p))))
+            >::type;
+            return unfold_status<Link, Next>{
+                Link{static_cast<Builder&&>(s.builder),
+                     Element{}(static_cast<P&&>(p))},
+                f(Seed{}(static_cast<P&&>(p)))
+            };
+        }
+
+        template <typename Builder>
+        constexpr unfold_status<Builder, hana::optional<>>&&
+        step(unfold_status<Builder, hana::optional<>>&& s) const
+        { return static_cast<unfold_status<Builder, hana::optional<>>&&>(s); }
+
+        template <typename Builder>
+        constexpr auto finish(unfold_status<Builder, hana::optional<>>&& s) const
+        { return k(static_cast<Builder&&>(s.builder)); }
+
+        template <typename Builder, typename P>
+        constexpr auto finish(unfold_status<Builder, hana::optional<P>>&& s) const
+        { return run(static_cast<unfold_status<Builder, hana::optional<P>>&&>(s)); }
+
+        template <typename Status>
+        constexpr auto run(Status&& s) const {
+            return finish(step(step(step(step(step(step(step(step(
+                          step(step(step(step(step(step(step(step(
+                static_cast<Status&&>(s)
+            )))))))))))))))));
+        }
+
+        template <typename Init>
+        constexpr auto operator()(Init&& init) const {
+            using Next = typename detail::decay<
+                decltype(f(static_cast<Init&&>(init)))
+            >::type;
+            return run(unfold_status<tuple_builder<>, Next>{
+                hana::make_tuple_builder(), f(static_cast<Init&&>(init))
+            });
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_UNFOLD_HPP
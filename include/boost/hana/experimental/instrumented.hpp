@@ -0,0 +1,157 @@
+/*!
+@file
+Defines `boost::hana::experimental::instrumented`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_INSTRUMENTED_HPP
+#define BOOST_HANA_EXPERIMENTAL_INSTRUMENTED_HPP
+
+#include <boost/hana/config.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Number of special member function calls performed on `instrumented`
+    //! objects.
+    //!
+    //! Counts can be subtracted from each other, which makes it easy to
+    //! compute the operations performed between two points in a program.
+    struct instrumentation_counts {
+        std::size_t constructions = 0;
+        std::size_t copies = 0;
+        std::size_t moves = 0;
+        std::size_t copy_assignments = 0;
+        std::size_t move_assignments = 0;
+        std::size_t destructions = 0;
+
+        friend constexpr instrumentation_counts
+        operator-(instrumentation_counts const& a, instrumentation_counts const& b) {
+            instrumentation_counts result{};
+            result.constructions = a.constructions - b.constructions;
+            result.copies = a.copies - b.copies;
+            result.moves = a.moves - b.moves;
+            result.copy_assignments = a.copy_assignments - b.copy_assignments;
+            result.move_assignments = a.move_assignments - b.move_assignments;
+            result.destructions = a.destructions - b.destructions;
+            return result;
+        }
+    };
+
+    namespace detail {
+        template <typename Tag>
+        struct instrumentation_registry {
+            static instrumentation_counts counts;
+        };
+
+        template <typename Tag>
+        instrumentation_counts instrumentation_registry<Tag>::counts{};
+    }
+
+    //! @ingroup group-experimental
+    //! Returns the global counts associated to the given `Tag`.
+    //!
+    //! All the `instrumented<T, Tag>` objects with the same `Tag` report
+    //! to the same counts, regardless of `T`. Using different tags makes it
+    //! possible to instrument several kinds of objects independently. The
+    //! counts are not synchronized, so instrumented objects should not be
+    //! used concurrently from several threads.
+    template <typename Tag = void>
+    instrumentation_counts& instrumentation()
+    { return detail::instrumentation_registry<Tag>::counts; }
+
+    //! @ingroup group-experimental
+    //! Calls `f()` and returns the operations performed on `instrumented`
+    //! objects with the given `Tag` during that call.
+    //!
+    //! The result of `f()` is destroyed before the counts are collected, so
+    //! its destruction is included in the returned counts.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @code
+    //!     auto counts = experimental::count_operations([] {
+    //!         return hana::transform(hana::make_tuple(instrumented<int>{1}), f);
+    //!     });
+    //!     assert(counts.copies == 0);
+    //! @endcode
+    template <typename Tag = void, typename F>
+    instrumentation_counts count_operations(F&& f) {
+        instrumentation_counts before = experimental::instrumentation<Tag>();
+        (void)static_cast<F&&>(f)();
+        return experimental::instrumentation<Tag>() - before;
+    }
+
+    //! @ingroup group-experimental
+    //! Wrapper counting the special member function calls performed on it.
+    //!
+    //! `instrumented<T, Tag>` holds an object of type `T` and reports every
+    //! construction, copy, move, assignment and destruction to the global
+    //! counts returned by `instrumentation<Tag>()`. This is meant to be
+    //! used as the element of a container to make sure that algorithms do
+    //! not copy or move elements more often than expected.
+    //!
+    //! Instrumented objects compare (with `==`, `!=` and `<`) according
+    //! to the value they hold.
+    template <typename T, typename Tag = void>
+    struct instrumented {
+        T value;
+
+        instrumented() : value() {
+            ++experimental::instrumentation<Tag>().constructions;
+        }
+
+        template <typename ...Args>
+        explicit instrumented(Args&& ...args)
+            : value(static_cast<Args&&>(args)...)
+        {
+            ++experimental::instrumentation<Tag>().constructions;
+        }
+
+        instrumented(instrumented const& other) : value(other.value) {
+            ++experimental::instrumentation<Tag>().copies;
+        }
+
+        instrumented(instrumented& other)
+            : instrumented(static_cast<instrumented const&>(other))
+        { }
+
+        instrumented(instrumented&& other) : value(std::move(other.value)) {
+            ++experimental::instrumentation<Tag>().moves;
+        }
+
+        instrumented& operator=(instrumented const& other) {
+            value = other.value;
+            ++experimental::instrumentation<Tag>().copy_assignments;
+            return *this;
+        }
+
+        instrumented& operator=(instrumented&& other) {
+            value = std::move(other.value);
+            ++experimental::instrumentation<Tag>().move_assignments;
+            return *this;
+        }
+
+        ~instrumented() {
+            ++experimental::instrumentation<Tag>().destructions;
+        }
+
+        friend bool operator==(instrumented const& a, instrumented const& b)
+        { return a.value == b.value; }
+
+        friend bool operator!=(instrumented const& a, instrumented const& b)
+        { return a.value != b.value; }
+
+        friend bool operator<(instrumented const& a, instrumented const& b)
+        { return a.value < b.value; }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_INSTRUMENTED_HPP
@@ -0,0 +1,457 @@
+/*
+@file
+Defines `boost::hana::experimental::parse` and related utilities.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PARSE_HPP
+#define BOOST_HANA_EXPERIMENTAL_PARSE_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+// Parsers are Parsing Expression Grammars (PEGs) encoded in types. Each
+// parser provides a `constexpr` function that matches it at some position
+// of a character array, and these functions are run over the characters of
+// a `hana::string` in a single constant expression. Hence, the characters
+// are processed with `constexpr` loops, and the only templates instantiated
+// for a string are the ones creating the resulting `hana::string`s from the
+// matched positions.
+//
+// Like with any PEG, the repetitions are greedy and the alternatives are
+// ordered, and there is no backtracking once a repetition or an alternative
+// has matched.
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        constexpr std::size_t no_match = static_cast<std::size_t>(-1);
+
+        // Half-open range of positions in a string.
+        struct char_range {
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        template <std::size_t N>
+        using captures = hana::detail::array<char_range, N>;
+
+        //////////////////////////////////////////////////////////////////////
+        // Parsers
+        //
+        // A parser `P` has a static member `captures`, which is the number of
+        // ranges it captures, and a static function
+        //
+        //      template <std::size_t Offset, std::size_t N>
+        //      match(char const* s, std::size_t n, std::size_t pos,
+        //            captures<N>& caps)
+        //
+        // that returns the position following the match of `P` at `pos` in
+        // the `n` first characters of `s`, or `no_match`. The ranges captured
+        // by `P` are written at `caps[Offset]` to `caps[Offset + captures]`.
+        //////////////////////////////////////////////////////////////////////
+        template <char ...c>
+        struct literal {
+            static constexpr std::size_t captures = 0;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>&) {
+                char const* lit = hana::string<c...>::c_str();
+                if (n - pos < sizeof...(c))
+                    return no_match;
+                for (std::size_t i = 0; i != sizeof...(c); ++i)
+                    if (s[pos + i] != lit[i])
+                        return no_match;
+                return pos + sizeof...(c);
+            }
+        };
+
+        template <typename Pred>
+        struct char_class {
+            static constexpr std::size_t captures = 0;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>&) {
+                return pos != n && Pred::test(s[pos]) ? pos + 1 : no_match;
+            }
+        };
+
+        struct any_pred {
+            static constexpr bool test(char) { return true; }
+        };
+
+        struct digit_pred {
+            static constexpr bool test(char c) { return c >= '0' && c <= '9'; }
+        };
+
+        struct alpha_pred {
+            static constexpr bool test(char c)
+            { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+        };
+
+        struct alnum_pred {
+            static constexpr bool test(char c)
+            { return alpha_pred::test(c) || digit_pred::test(c); }
+        };
+
+        struct space_pred {
+            static constexpr bool test(char c)
+            { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+        };
+
+        template <char lo, char hi>
+        struct range_pred {
+            static constexpr bool test(char c) { return c >= lo && c <= hi; }
+        };
+
+        template <char ...c>
+        struct one_of_pred {
+            static constexpr bool test(char x) {
+                char const* chars = hana::string<c...>::c_str();
+                for (std::size_t i = 0; i != sizeof...(c); ++i)
+                    if (chars[i] == x)
+                        return true;
+                return false;
+            }
+        };
+
+        template <typename ...P>
+        struct sequence;
+
+        template <>
+        struct sequence<> {
+            static constexpr std::size_t captures = 0;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const*, std::size_t, std::size_t pos, detail::captures<N>&)
+            { return pos; }
+        };
+
+        template <typename P, typename ...Ps>
+        struct sequence<P, Ps...> {
+            static constexpr std::size_t captures =
+                P::captures + sequence<Ps...>::captures;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>& caps) {
+                std::size_t next = P::template match<Offset>(s, n, pos, caps);
+                if (next == no_match)
+                    return no_match;
+                return sequence<Ps...>::template match<Offset + P::captures>(
+                    s, n, next, caps);
+            }
+        };
+
+        template <typename ...P>
+        struct alternative;
+
+        template <>
+        struct alternative<> {
+            static constexpr std::size_t captures = 0;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const*, std::size_t, std::size_t, detail::captures<N>&)
+            { return no_match; }
+        };
+
+        // The ranges captured by a failed alternative are restored, so
+        // that the result does not depend on the alternatives tried first.
+        template <typename P, typename ...Ps>
+        struct alternative<P, Ps...> {
+            static constexpr std::size_t captures =
+                P::captures + alternative<Ps...>::captures;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>& caps) {
+                detail::captures<N> saved = caps;
+                std::size_t next = P::template match<Offset>(s, n, pos, caps);
+                if (next != no_match)
+                    return next;
+                caps = saved;
+                return alternative<Ps...>::template match<Offset + P::captures>(
+                    s, n, pos, caps);
+            }
+        };
+
+        // Matches `P` between `min` and `max` times (`max == 0` means no
+        // upper bound), stopping early if `P` matches an empty string.
+        template <typename P, std::size_t min, std::size_t max>
+        struct repeat {
+            static constexpr std::size_t captures = P::captures;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>& caps) {
+                std::size_t count = 0;
+                while (max == 0 || count != max) {
+                    detail::captures<N> saved = caps;
+                    std::size_t next = P::template match<Offset>(s, n, pos, caps);
+                    if (next == no_match) {
+                        caps = saved;
+                        break;
+                    }
+                    ++count;
+                    if (next == pos)
+                        break;
+                    pos = next;
+                }
+                return count >= min ? pos : no_match;
+            }
+        };
+
+        template <typename P>
+        struct capture {
+            static constexpr std::size_t captures = P::captures + 1;
+
+            template <std::size_t Offset, std::size_t N>
+            static constexpr std::size_t
+            match(char const* s, std::size_t n, std::size_t pos, detail::captures<N>& caps) {
+                std::size_t next = P::template match<Offset + 1>(s, n, pos, caps);
+                if (next != no_match)
+                    caps[Offset] = char_range{pos, next};
+                return next;
+            }
+        };
+
+        // Allows `hana::string`s to be used as literal parsers.
+        template <typename P>
+        struct as_parser { using type = P; };
+
+        template <char ...c>
+        struct as_parser<hana::string<c...>> { using type = literal<c...>; };
+
+        template <typename P>
+        using as_parser_t = typename as_parser<P>::type;
+
+        //////////////////////////////////////////////////////////////////////
+        // Running parsers
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        struct parse_result {
+            bool matched;
+            detail::captures<N> ranges;
+        };
+
+        template <typename P, char ...s>
+        constexpr parse_result<P::captures> run_parser() {
+            parse_result<P::captures> result{false, {}};
+            std::size_t end = P::template match<0>(
+                hana::string<s...>::c_str(), sizeof...(s), 0, result.ranges);
+            result.matched = end == sizeof...(s);
+            return result;
+        }
+
+        // Returns the ranges of the characters between the non-overlapping
+        // matches of `Sep`, from left to right. A first pass counts them so
+        // that the second one can store them in an array of the right size.
+        template <typename Sep, std::size_t Size, char ...s>
+        constexpr hana::detail::array<char_range, Size> split_ranges() {
+            hana::detail::array<char_range, Size> result{};
+            detail::captures<Sep::captures> caps{};
+            char const* str = hana::string<s...>::c_str();
+            std::size_t pieces = 0, begin = 0, pos = 0;
+            while (pos != sizeof...(s)) {
+                std::size_t next = Sep::template match<0>(str, sizeof...(s), pos, caps);
+                if (next == no_match || next == pos) {
+                    ++pos;
+                    continue;
+                }
+                if (pieces != Size)
+                    result[pieces] = char_range{begin, pos};
+                ++pieces;
+                begin = pos = next;
+            }
+            if (pieces != Size)
+                result[pieces] = char_range{begin, pos};
+            return result;
+        }
+
+        template <typename Sep, char ...s>
+        constexpr std::size_t split_count() {
+            detail::captures<Sep::captures> caps{};
+            char const* str = hana::string<s...>::c_str();
+            std::size_t pieces = 1, pos = 0;
+            while (pos != sizeof...(s)) {
+                std::size_t next = Sep::template match<0>(str, sizeof...(s), pos, caps);
+                if (next == no_match || next == pos)
+                    ++pos;
+                else {
+                    ++pieces;
+                    pos = next;
+                }
+            }
+            return pieces;
+        }
+
+        template <std::size_t begin, char ...s, std::size_t ...i>
+        constexpr hana::string<hana::detail::string_storage<s...>[begin + i]...>
+        substring(std::index_sequence<i...>)
+        { return {}; }
+
+        template <typename Ranges, char ...s, std::size_t ...k>
+        constexpr auto make_substrings(std::index_sequence<k...>) {
+            constexpr auto ranges = Ranges::get();
+            (void)ranges; // unused when there are no ranges
+            return hana::make_tuple(detail::substring<ranges[k].begin, s...>(
+                std::make_index_sequence<ranges[k].end - ranges[k].begin>{}
+            )...);
+        }
+
+        template <typename P, char ...s>
+        struct parse_ranges {
+            static constexpr auto get()
+            { return detail::run_parser<P, s...>().ranges; }
+        };
+
+        template <typename Sep, char ...s>
+        struct split_ranges_of {
+            static constexpr auto get() {
+                return detail::split_ranges<
+                    Sep, detail::split_count<Sep, s...>(), s...
+                >();
+            }
+        };
+
+        template <typename P, char ...s>
+        constexpr auto parse_impl(hana::true_) {
+            return hana::just(detail::make_substrings<parse_ranges<P, s...>, s...>(
+                std::make_index_sequence<P::captures>{}
+            ));
+        }
+
+        template <typename P, char ...s>
+        constexpr auto parse_impl(hana::false_)
+        { return hana::nothing; }
+    } // end namespace detail
+
+    //! @ingroup group-experimental
+    //! Parser matching the given `hana::string`.
+    //!
+    //! A `hana::string` can also be used directly where a parser is expected,
+    //! in which case it is equivalent to `lit(string)`.
+    template <char ...c>
+    constexpr detail::literal<c...> lit(hana::string<c...>) { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the single character `c`.
+    template <char c>
+    constexpr detail::literal<c> ch{};
+
+    //! @ingroup group-experimental
+    //! Parser matching any character in the given `hana::string`.
+    template <char ...c>
+    constexpr detail::char_class<detail::one_of_pred<c...>>
+    one_of(hana::string<c...>) { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching any character between `lo` and `hi`, inclusively.
+    template <char lo, char hi>
+    constexpr detail::char_class<detail::range_pred<lo, hi>> char_in{};
+
+    //! @ingroup group-experimental
+    //! Parsers matching any character, or a single character of the usual
+    //! classes, in the "C" locale.
+    constexpr detail::char_class<detail::any_pred> any_char{};
+    constexpr detail::char_class<detail::digit_pred> digit{};
+    constexpr detail::char_class<detail::alpha_pred> alpha{};
+    constexpr detail::char_class<detail::alnum_pred> alnum{};
+    constexpr detail::char_class<detail::space_pred> space{};
+
+    //! @ingroup group-experimental
+    //! Parser matching each of the given parsers, one after the other.
+    template <typename ...P>
+    constexpr detail::sequence<detail::as_parser_t<P>...> seq(P const& ...)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the first of the given parsers that matches.
+    template <typename ...P>
+    constexpr detail::alternative<detail::as_parser_t<P>...> alt(P const& ...)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the given parser as many times as possible, including
+    //! zero times.
+    template <typename P>
+    constexpr detail::repeat<detail::as_parser_t<P>, 0, 0> many(P const&)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the given parser as many times as possible, but at
+    //! least once.
+    template <typename P>
+    constexpr detail::repeat<detail::as_parser_t<P>, 1, 0> some(P const&)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the given parser, or nothing.
+    template <typename P>
+    constexpr detail::repeat<detail::as_parser_t<P>, 0, 1> opt(P const&)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Parser matching the given parser, and capturing the matched characters.
+    //!
+    //! When a capture is matched several times, for example inside `many`,
+    //! the last match is kept. A capture that was not matched is empty.
+    template <typename P>
+    constexpr detail::capture<detail::as_parser_t<P>> capture(P const&)
+    { return {}; }
+
+    //! @ingroup group-experimental
+    //! Matches a parser against a whole `hana::string`, at compile-time.
+    //!
+    //! If the parser matches all the characters of the string, this returns
+    //! `hana::just(hana::make_tuple(captures...))`, where `captures...` are
+    //! the `hana::string`s captured with `experimental::capture`, in the
+    //! order in which the captures appear in the parser. Otherwise, this
+    //! returns `hana::nothing`.
+    //!
+    //! The string is parsed in a single constant expression looping over
+    //! the characters of `str.c_str()`, so parsing a string does not require
+    //! instantiating templates for each of its characters.
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/parse.cpp
+    template <char ...s, typename P>
+    constexpr auto parse(hana::string<s...>, P const&) {
+        using Parser = detail::as_parser_t<P>;
+        constexpr bool matched = detail::run_parser<Parser, s...>().matched;
+        return detail::parse_impl<Parser, s...>(hana::bool_c<matched>);
+    }
+
+    //! @ingroup group-experimental
+    //! Splits a `hana::string` at the matches of a separator, at compile-time.
+    //!
+    //! Returns a `hana::tuple` of the `hana::string`s between the
+    //! non-overlapping matches of `sep`, from left to right. Like for
+    //! `experimental::parse`, the separators are searched with a `constexpr`
+    //! loop. A string without separators is split into a single piece, and
+    //! consecutive separators yield empty pieces.
+    template <char ...s, typename Sep>
+    constexpr auto split(hana::string<s...>, Sep const&) {
+        using Parser = detail::as_parser_t<Sep>;
+        constexpr std::size_t n = detail::split_count<Parser, s...>();
+        return detail::make_substrings<detail::split_ranges_of<Parser, s...>, s...>(
+            std::make_index_sequence<n>{}
+        );
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PARSE_HPP
@@ -0,0 +1,390 @@
+/*
+@file
+Defines `boost::hana::experimental::type_arena`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TYPE_ARENA_HPP
+#define BOOST_HANA_EXPERIMENTAL_TYPE_ARENA_HPP
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+// The arena is a single allocation holding one chunk per type. The chunk of
+// a type `T` is aligned on a cache line (or more if `T` requires it), and it
+// is made of `capacity` slots for `T`s, followed by `capacity` links. The
+// link of a slot is `alive` when the slot holds a `T`, and otherwise it is
+// the index of the next free slot, or `npos`. Slots at or after `used` have
+// never held anything, so they are not linked.
+//
+// The bookkeeping of each chunk is stored in a `hana::map` from `hana::type`s
+// to `detail::type_arena_storage`s, so that finding the chunk of a type is a
+// compile-time lookup.
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        constexpr std::size_t type_arena_cache_line = 64;
+
+        template <typename T>
+        constexpr std::size_t type_arena_alignment() {
+            return alignof(T) > type_arena_cache_line ? alignof(T)
+                                                      : type_arena_cache_line;
+        }
+
+        constexpr std::size_t type_arena_align(std::size_t offset, std::size_t alignment)
+        { return (offset + alignment - 1) / alignment * alignment; }
+
+        template <typename T>
+        struct type_arena_storage {
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+            static constexpr std::size_t alive = static_cast<std::size_t>(-2);
+
+            T* slots = nullptr;
+            std::size_t* links = nullptr;
+            std::size_t size = 0;
+            std::size_t used = 0;
+            std::size_t free = npos;
+
+            // Returns the offset following the chunk of `T` placed at the
+            // first suitable offset after `offset`, and moves the chunk
+            // there if `base` is not null.
+            std::size_t relocate(unsigned char* base, std::size_t offset,
+                                 std::size_t capacity)
+            {
+                std::size_t slots_offset = detail::type_arena_align(
+                    offset, detail::type_arena_alignment<T>());
+                std::size_t links_offset = detail::type_arena_align(
+                    slots_offset + capacity * sizeof(T), alignof(std::size_t));
+                std::size_t end = links_offset + capacity * sizeof(std::size_t);
+                if (base == nullptr)
+                    return end;
+
+                T* new_slots = reinterpret_cast<T*>(base + slots_offset);
+                std::size_t* new_links = reinterpret_cast<std::size_t*>(base + links_offset);
+                for (std::size_t i = 0; i != used; ++i) {
+                    new_links[i] = links[i];
+                    if (links[i] == alive) {
+                        ::new (static_cast<void*>(new_slots + i)) T(std::move(slots[i]));
+                        slots[i].~T();
+                    }
+                }
+                slots = new_slots;
+                links = new_links;
+                return end;
+            }
+
+            void clear() {
+                for (std::size_t i = 0; i != used; ++i)
+                    if (links[i] == alive)
+                        slots[i].~T();
+                size = used = 0;
+                free = npos;
+            }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Stable handle to an object of type `T` in a `type_arena`.
+    //!
+    //! A handle stays valid when the arena grows, until the object it refers
+    //! to is erased. After that, the slot of the object may be reused by
+    //! another object of the same type.
+    template <typename T>
+    struct type_arena_handle {
+        std::size_t index;
+    };
+
+    //! @ingroup group-experimental
+    //! Reference to the chunk holding the objects of type `T` in a
+    //! `type_arena`.
+    //!
+    //! A `type_arena_chunk` is a lightweight reference that is obtained with
+    //! `hana::at_key(arena, hana::type_c<T>)`; it remains valid as long as
+    //! the arena is alive. If the arena is `const`, the chunk is a
+    //! `type_arena_chunk<T const>`.
+    template <typename T>
+    struct type_arena_chunk {
+        using storage_type = detail::type_arena_storage<
+            typename std::remove_const<T>::type
+        >;
+        using pointer_type = typename std::conditional<std::is_const<T>::value,
+            storage_type const*, storage_type*
+        >::type;
+
+        pointer_type storage;
+
+        //! Returns the number of objects in the chunk.
+        std::size_t size() const { return storage->size; }
+
+        //! Returns the object referred to by a handle.
+        T& operator[](type_arena_handle<typename std::remove_const<T>::type> h) const
+        { return storage->slots[h.index]; }
+
+        //! Calls `f` with each object in the chunk, in the order of the
+        //! slots holding them.
+        template <typename F>
+        void for_each(F&& f) const {
+            for (std::size_t i = 0; i != storage->used; ++i)
+                if (storage->links[i] == storage_type::alive)
+                    f(static_cast<T&>(storage->slots[i]));
+        }
+    };
+
+    //! @ingroup group-experimental
+    //! Container holding objects of the types `Ts...` in a single allocation.
+    //!
+    //! A `type_arena` stores the objects of each type in a contiguous chunk
+    //! aligned on a cache line, and all the chunks live in a single
+    //! allocation. All chunks have the same capacity, and the whole arena
+    //! grows (by doubling the capacity) when a chunk is full. Objects are
+    //! referred to by `type_arena_handle`s, which remain valid when the
+    //! arena grows. The slot of an erased object is reused by the next
+    //! object of the same type, so erasing does not move other objects.
+    //!
+    //! A `type_arena` is a `Searchable` whose keys are the `hana::type`s of
+    //! `Ts...`, and whose values are the `type_arena_chunk`s for these types.
+    //! In particular, `hana::at_key(arena, hana::type_c<T>)` is resolved at
+    //! compile-time. Since objects are moved when the arena grows, the `Ts`
+    //! must be nothrow move constructible.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/type_arena.cpp
+    template <typename ...Ts>
+    struct type_arena;
+
+    struct type_arena_tag;
+
+    template <typename ...Ts>
+    struct type_arena {
+        static_assert(hana::detail::fast_and<
+            std::is_nothrow_move_constructible<Ts>::value...
+        >::value,
+        "hana::experimental::type_arena<Ts...> requires the Ts to be nothrow "
+        "move constructible");
+
+        //! Creates an arena with room for `capacity` objects of each type.
+        explicit type_arena(std::size_t capacity = 0) { reserve(capacity); }
+
+        type_arena(type_arena&& other) noexcept
+            : storage_(other.storage_)
+            , memory_(std::move(other.memory_))
+            , capacity_(other.capacity_)
+        {
+            other.storage_ = storage_type{};
+            other.capacity_ = 0;
+        }
+
+        type_arena& operator=(type_arena&& other) noexcept {
+            if (this != &other) {
+                clear();
+                storage_ = other.storage_;
+                memory_ = std::move(other.memory_);
+                capacity_ = other.capacity_;
+                other.storage_ = storage_type{};
+                other.capacity_ = 0;
+            }
+            return *this;
+        }
+
+        type_arena(type_arena const&) = delete;
+        type_arena& operator=(type_arena const&) = delete;
+
+        ~type_arena() { clear(); }
+
+        //! Returns the number of objects of each type that fit in the arena
+        //! without growing it.
+        std::size_t capacity() const { return capacity_; }
+
+        //! Grows the arena so that `capacity` objects of each type fit in it.
+        void reserve(std::size_t capacity) {
+            if (capacity <= capacity_)
+                return;
+
+            std::size_t bytes = 0;
+            hana::for_each(types(), [&](auto t) {
+                bytes = this->storage(t).relocate(nullptr, bytes, capacity);
+            });
+
+            constexpr std::size_t alignment = alignment_();
+            std::unique_ptr<unsigned char[]> memory{
+                new unsigned char[bytes + alignment - 1]
+            };
+            unsigned char* base = memory.get() + (alignment -
+                reinterpret_cast<std::uintptr_t>(memory.get()) % alignment) % alignment;
+
+            std::size_t offset = 0;
+            hana::for_each(types(), [&](auto t) {
+                offset = this->storage(t).relocate(base, offset, capacity);
+            });
+            memory_ = std::move(memory);
+            capacity_ = capacity;
+        }
+
+        //! Constructs an object of type `T` from `args...` in the arena, and
+        //! returns a handle to it.
+        //!
+        //! Like for `std::vector::emplace_back`, `args...` may refer to
+        //! objects in the arena, even if the arena has to grow.
+        template <typename T, typename ...Args>
+        type_arena_handle<T> emplace(hana::basic_type<T> const& t, Args&& ...args) {
+            auto& s = storage(t);
+            if (s.free == s.npos && s.used == capacity_) {
+                // Growing moves the objects of the arena, so the new object
+                // is constructed before, while `args...` are still valid.
+                T x(static_cast<Args&&>(args)...);
+                reserve(capacity_ == 0 ? 8 : 2 * capacity_);
+                return construct_(s, static_cast<T&&>(x));
+            }
+            return construct_(s, static_cast<Args&&>(args)...);
+        }
+
+        //! Destroys the object referred to by a handle.
+        template <typename T>
+        void erase(type_arena_handle<T> h) {
+            auto& s = storage(hana::type_c<T>);
+            s.slots[h.index].~T();
+            s.links[h.index] = s.free;
+            s.free = h.index;
+            --s.size;
+        }
+
+        //! Returns the object referred to by a handle.
+        template <typename T>
+        T& operator[](type_arena_handle<T> h)
+        { return storage(hana::type_c<T>).slots[h.index]; }
+
+        template <typename T>
+        T const& operator[](type_arena_handle<T> h) const
+        { return storage(hana::type_c<T>).slots[h.index]; }
+
+        //! Calls `f` with the chunk of each type, in the order of `Ts...`.
+        template <typename F>
+        void for_each_type(F&& f) {
+            hana::for_each(types(), [&](auto t) {
+                using T = typename decltype(t)::type;
+                f(type_arena_chunk<T>{&this->storage(t)});
+            });
+        }
+
+        template <typename F>
+        void for_each_type(F&& f) const {
+            hana::for_each(types(), [&](auto t) {
+                using T = typename decltype(t)::type;
+                f(type_arena_chunk<T const>{&this->storage(t)});
+            });
+        }
+
+        //! Destroys all the objects in the arena, without releasing its memory.
+        void clear() {
+            hana::for_each(types(), [&](auto t) { this->storage(t).clear(); });
+        }
+
+        // Used to implement the Searchable instance; not part of the
+        // public interface.
+        using storage_type = hana::map<
+            hana::pair<hana::type<Ts>, detail::type_arena_storage<Ts>>...
+        >;
+
+        template <typename T>
+        detail::type_arena_storage<T>& storage(hana::basic_type<T> const& t)
+        { return hana::at_key(storage_, t); }
+
+        template <typename T>
+        detail::type_arena_storage<T> const& storage(hana::basic_type<T> const& t) const
+        { return hana::at_key(storage_, t); }
+
+        static constexpr hana::basic_tuple<hana::type<Ts>...> types() { return {}; }
+
+    private:
+        // Constructs a `T` in the first free slot of a chunk that is not full.
+        template <typename T, typename ...Args>
+        static type_arena_handle<T>
+        construct_(detail::type_arena_storage<T>& s, Args&& ...args) {
+            std::size_t i = s.free != s.npos ? s.free : s.used;
+            ::new (static_cast<void*>(s.slots + i)) T(static_cast<Args&&>(args)...);
+            if (i == s.free)
+                s.free = s.links[i];
+            else
+                ++s.used;
+            s.links[i] = s.alive;
+            ++s.size;
+            return {i};
+        }
+
+        static constexpr std::size_t alignment_() {
+            std::size_t alignments[] = {1, detail::type_arena_alignment<Ts>()...};
+            std::size_t result = 1;
+            for (std::size_t a : alignments)
+                result = a > result ? a : result;
+            return result;
+        }
+
+        storage_type storage_;
+        std::unique_ptr<unsigned char[]> memory_;
+        std::size_t capacity_ = 0;
+    };
+} // end namespace experimental
+
+    template <typename ...Ts>
+    struct tag_of<experimental::type_arena<Ts...>> {
+        using type = experimental::type_arena_tag;
+    };
+
+    // Searchable
+    template <>
+    struct at_key_impl<experimental::type_arena_tag> {
+        template <typename ...Ts, typename Key>
+        static auto apply(experimental::type_arena<Ts...>& arena, Key const& key) {
+            using T = typename Key::type;
+            return experimental::type_arena_chunk<T>{&arena.storage(key)};
+        }
+
+        template <typename ...Ts, typename Key>
+        static auto apply(experimental::type_arena<Ts...> const& arena, Key const& key) {
+            using T = typename Key::type;
+            return experimental::type_arena_chunk<T const>{&arena.storage(key)};
+        }
+    };
+
+    template <>
+    struct find_if_impl<experimental::type_arena_tag> {
+        template <typename Arena, typename Pred>
+        static auto apply(Arena&& arena, Pred&& pred) {
+            auto chunks = hana::unpack(arena.types(), [&](auto ...t) {
+                return hana::make_map(hana::make_pair(t, hana::at_key(arena, t))...);
+            });
+            return hana::find_if(chunks, static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct any_of_impl<experimental::type_arena_tag> {
+        template <typename Arena, typename Pred>
+        static constexpr auto apply(Arena const& arena, Pred&& pred)
+        { return hana::any_of(arena.types(), static_cast<Pred&&>(pred)); }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TYPE_ARENA_HPP
@@ -0,0 +1,207 @@
+/*!
+@file
+Defines `boost::hana::format` and `boost::hana::formatter`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FORMAT_HPP
+#define BOOST_HANA_FORMAT_HPP
+
+#include <boost/hana/fwd/format.hpp>
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus > 201402L && defined(__has_include)
+#   if __has_include(<charconv>)
+#       include <charconv>
+#   endif
+#endif
+
+// Floating point arguments are written with `std::to_chars`, which does not
+// depend on the locale. When it is not available, they are rejected instead
+// of being written differently.
+#if defined(__cpp_lib_to_chars)
+#   define BOOST_HANA_FORMAT_HAS_TO_CHARS
+#endif
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        //////////////////////////////////////////////////////////////////////
+        // Format plans
+        //
+        // The plan of a format string holds its literal text, with the
+        // escape sequences resolved, and the offset in that text at which
+        // each placeholder appears. Hence, the arguments are written between
+        // `text[ends[i - 1]]` and `text[ends[i]]`, with `ends[-1] == 0`, and
+        // the last piece of text ends at `ends[placeholders]`.
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        struct format_plan {
+            char text[N + 1];
+            std::size_t ends[N + 1];
+            std::size_t placeholders;
+            bool valid;
+        };
+
+        template <char ...s>
+        constexpr format_plan<sizeof...(s)> make_format_plan() {
+            constexpr std::size_t n = sizeof...(s);
+            char const* str = hana::string<s...>::c_str();
+            format_plan<n> plan{};
+            plan.valid = true;
+            std::size_t length = 0;
+            for (std::size_t i = 0; i != n; ++i) {
+                char next = i + 1 != n ? str[i + 1] : '\0';
+                if (str[i] == '{' && next == '}')
+                    plan.ends[plan.placeholders++] = length;
+                else if ((str[i] == '{' || str[i] == '}') && next == str[i])
+                    plan.text[length++] = str[i];
+                else if (str[i] == '{' || str[i] == '}')
+                    plan.valid = false;
+                else {
+                    plan.text[length++] = str[i];
+                    continue;
+                }
+                ++i;
+            }
+            plan.ends[plan.placeholders] = length;
+            return plan;
+        }
+
+        template <char ...s>
+        constexpr format_plan<sizeof...(s)> format_plan_v = make_format_plan<s...>();
+
+        //////////////////////////////////////////////////////////////////////
+        // Writing the arguments
+        //////////////////////////////////////////////////////////////////////
+        // `ptr` becomes null as soon as something does not fit in the buffer.
+        struct format_buffer {
+            char* ptr;
+            char* last;
+
+            void write(char const* s, std::size_t n) {
+                if (ptr == nullptr || static_cast<std::size_t>(last - ptr) < n) {
+                    ptr = nullptr;
+                    return;
+                }
+                std::memcpy(ptr, s, n);
+                ptr += n;
+            }
+        };
+
+        inline void format_arg(format_buffer& out, bool b) {
+            if (b) out.write("true", 4);
+            else   out.write("false", 5);
+        }
+
+        inline void format_arg(format_buffer& out, char c)
+        { out.write(&c, 1); }
+
+        inline void format_arg(format_buffer& out, char const* s)
+        { out.write(s, std::strlen(s)); }
+
+        template <char ...c>
+        void format_arg(format_buffer& out, hana::string<c...> const&)
+        { out.write(hana::string<c...>::c_str(), sizeof...(c)); }
+
+        template <typename T>
+        constexpr bool format_is_negative(T value, std::true_type)
+        { return value < 0; }
+
+        template <typename T>
+        constexpr bool format_is_negative(T, std::false_type)
+        { return false; }
+
+        template <typename T, typename = typename std::enable_if<
+            std::is_integral<T>::value
+        >::type>
+        void format_arg(format_buffer& out, T value) {
+            using U = typename std::make_unsigned<T>::type;
+            bool negative = detail::format_is_negative(value, std::is_signed<T>{});
+            // The magnitude is computed with unsigned arithmetic, so that
+            // the lowest value of a signed type does not overflow.
+            U magnitude = negative ? static_cast<U>(0 - static_cast<U>(value))
+                                   : static_cast<U>(value);
+            char digits[sizeof(T) * 3 + 1];
+            char* first = digits + sizeof(digits);
+            do {
+                *--first = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (negative)
+                *--first = '-';
+            out.write(first, static_cast<std::size_t>(digits + sizeof(digits) - first));
+        }
+
+        template <typename T, typename = typename std::enable_if<
+            std::is_floating_point<T>::value
+        >::type, typename = void>
+        void format_arg(format_buffer& out, T value) {
+        #ifdef BOOST_HANA_FORMAT_HAS_TO_CHARS
+            char digits[64];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            out.write(digits, static_cast<std::size_t>(result.ptr - digits));
+        #else
+            static_assert(detail::wrong<T>{},
+            "hana::format: floating point arguments require std::to_chars, "
+            "which is not provided by the standard library in this mode");
+            (void)out; (void)value;
+        #endif
+        }
+
+        template <typename S>
+        auto format_arg(format_buffer& out, S const& s)
+            -> decltype((void)(s.data() + s.size()))
+        { out.write(s.data(), s.size()); }
+    }
+
+    //! @cond
+    template <char ...s>
+    struct formatter {
+        static constexpr std::size_t placeholders =
+            detail::format_plan_v<s...>.placeholders;
+
+        static_assert(detail::format_plan_v<s...>.valid,
+        "hana::format(str) requires each '{' and '}' in 'str' to either be part "
+        "of a '{}' placeholder or be doubled");
+
+        template <std::size_t ...i, typename ...Args>
+        static char* write(char* first, char* last, std::index_sequence<i...>,
+                           Args const& ...args)
+        {
+            constexpr auto const& plan = detail::format_plan_v<s...>;
+            detail::format_buffer out{first, last};
+            out.write(plan.text, plan.ends[0]);
+            int expand[] = {0, (
+                detail::format_arg(out, args),
+                out.write(plan.text + plan.ends[i], plan.ends[i + 1] - plan.ends[i]),
+            0)...};
+            (void)expand;
+            return out.ptr;
+        }
+
+        template <typename ...Args>
+        char* operator()(char* first, char* last, Args const& ...args) const {
+            static_assert(sizeof...(Args) == placeholders,
+            "hana::formatter: the number of arguments must be the same as the "
+            "number of '{}' placeholders in the format string");
+
+            return formatter::write(first, last,
+                std::make_index_sequence<sizeof...(Args)>{}, args...);
+        }
+    };
+    //! @endcond
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FORMAT_HPP
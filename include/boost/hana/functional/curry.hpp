@@ -12,7 +12,6 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
-#include <boost/hana/functional/apply.hpp>
 #include <boost/hana/functional/partial.hpp>
 
 #include <cstddef>
@@ -112,11 +111,25 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr make_curry_t<n> curry{};
 
     namespace curry_detail {
-        template <std::size_t n>
-        constexpr make_curry_t<n> curry_or_call{};
+        // Once all the arguments have been provided, the function is called
+        // directly. Otherwise, the arguments are appended to the flat storage
+        // of a `partial` application, so currying never nests closures.
+        template <std::size_t remaining>
+        struct curry_or_call {
+            template <typename F, typename ...X>
+            static constexpr auto apply(F&& f, X&& ...x) {
+                return make_curry_t<remaining>{}(
+                    hana::partial(static_cast<F&&>(f), static_cast<X&&>(x)...)
+                );
+            }
+        };
 
         template <>
-        constexpr auto curry_or_call<0> = apply;
+        struct curry_or_call<0> {
+            template <typename F, typename ...X>
+            static constexpr decltype(auto) apply(F&& f, X&& ...x)
+            { return static_cast<F&&>(f)(static_cast<X&&>(x)...); }
+        };
     }
 
     template <std::size_t n, typename F>
@@ -127,8 +140,8 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(X&& ...x) const& {
             static_assert(sizeof...(x) <= n,
             "too many arguments provided to boost::hana::curry");
-            return curry_detail::curry_or_call<n - sizeof...(x)>(
-                partial(f, static_cast<X&&>(x)...)
+            return curry_detail::curry_or_call<n - sizeof...(x)>::apply(
+                f, static_cast<X&&>(x)...
             );
         }
 
@@ -136,8 +149,8 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(X&& ...x) & {
             static_assert(sizeof...(x) <= n,
             "too many arguments provided to boost::hana::curry");
-            return curry_detail::curry_or_call<n - sizeof...(x)>(
-                partial(f, static_cast<X&&>(x)...)
+            return curry_detail::curry_or_call<n - sizeof...(x)>::apply(
+                f, static_cast<X&&>(x)...
             );
         }
 
@@ -145,8 +158,8 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(X&& ...x) && {
             static_assert(sizeof...(x) <= n,
             "too many arguments provided to boost::hana::curry");
-            return curry_detail::curry_or_call<n - sizeof...(x)>(
-                partial(std::move(f), static_cast<X&&>(x)...)
+            return curry_detail::curry_or_call<n - sizeof...(x)>::apply(
+                std::move(f), static_cast<X&&>(x)...
             );
         }
     };
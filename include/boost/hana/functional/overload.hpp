@@ -12,6 +12,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/type_at.hpp>
+
+#include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -38,21 +42,109 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     };
 #else
+    template <typename F, typename ...G>
+    struct overload_t;
+
+#if defined(__cpp_variadic_using) && __cpp_variadic_using >= 201611L
     template <typename F, typename ...G>
     struct overload_t
         : overload_t<F>::type
-        , overload_t<G...>::type
+        , overload_t<G>::type...
     {
         using type = overload_t;
         using overload_t<F>::type::operator();
-        using overload_t<G...>::type::operator();
+        using overload_t<G>::type::operator()...;
 
         template <typename F_, typename ...G_>
         constexpr explicit overload_t(F_&& f, G_&& ...g)
             : overload_t<F>::type(static_cast<F_&&>(f))
-            , overload_t<G...>::type(static_cast<G_&&>(g)...)
+            , overload_t<G>::type(static_cast<G_&&>(g))...
         { }
     };
+#else
+    namespace detail {
+        // Arguments of the `overload_t` constructor, held by reference so
+        // that every leaf of the inheritance tree can pick its own function
+        // in constant time, without recursing over the argument pack.
+        template <std::size_t i, typename X>
+        struct overload_arg { X&& x; };
+
+        template <typename Indices, typename ...X>
+        struct overload_args;
+
+        template <std::size_t ...i, typename ...X>
+        struct overload_args<std::index_sequence<i...>, X...>
+            : overload_arg<i, X>...
+        {
+            constexpr explicit overload_args(X&& ...x)
+                : overload_arg<i, X>{static_cast<X&&>(x)}...
+            { }
+        };
+
+        template <std::size_t i, typename X>
+        constexpr X&& overload_get(overload_arg<i, X> const& arg)
+        { return static_cast<X&&>(arg.x); }
+
+        // Balanced tree of bases used to implement `overload_t` when using
+        // declarations can't be pack-expanded. The first half of the
+        // functions goes into the left subtree, and the second half into
+        // the right subtree, which keeps the depth of the inheritance
+        // hierarchy logarithmic in the number of functions.
+        template <std::size_t offset, typename Left, typename Right, typename ...F>
+        struct overload_node;
+
+        template <std::size_t offset, typename ...F>
+        using overload_tree = overload_node<offset,
+            std::make_index_sequence<sizeof...(F) / 2>,
+            std::make_index_sequence<sizeof...(F) - sizeof...(F) / 2>,
+            F...
+        >;
+
+        template <std::size_t offset, std::size_t ...l, std::size_t ...r, typename ...F>
+        struct overload_node<offset, std::index_sequence<l...>, std::index_sequence<r...>, F...>
+            : overload_tree<offset, typename type_at<l, F...>::type...>
+            , overload_tree<offset + sizeof...(l), typename type_at<sizeof...(l) + r, F...>::type...>
+        {
+            using Left = overload_tree<offset, typename type_at<l, F...>::type...>;
+            using Right = overload_tree<offset + sizeof...(l), typename type_at<sizeof...(l) + r, F...>::type...>;
+            using Left::operator();
+            using Right::operator();
+
+            template <typename Indices, typename ...X>
+            constexpr explicit overload_node(overload_args<Indices, X...> const& args)
+                : Left(args), Right(args)
+            { }
+        };
+
+        template <std::size_t offset, typename F>
+        struct overload_node<offset, std::index_sequence<>, std::index_sequence<0>, F>
+            : overload_t<F>::type
+        {
+            using overload_t<F>::type::operator();
+
+            template <typename Indices, typename ...X>
+            constexpr explicit overload_node(overload_args<Indices, X...> const& args)
+                : overload_t<F>::type(detail::overload_get<offset>(args))
+            { }
+        };
+    }
+
+    template <typename F, typename ...G>
+    struct overload_t
+        : detail::overload_tree<0, F, G...>
+    {
+        using type = overload_t;
+
+        template <typename F_, typename ...G_>
+        constexpr explicit overload_t(F_&& f, G_&& ...g)
+            : detail::overload_tree<0, F, G...>(
+                detail::overload_args<
+                    std::make_index_sequence<sizeof...(G_) + 1>, F_, G_...
+                >(static_cast<F_&&>(f), static_cast<G_&&>(g)...)
+            )
+        { }
+    };
+#endif
 
     template <typename F>
     struct overload_t<F> { using type = F; };
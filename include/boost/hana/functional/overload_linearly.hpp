@@ -10,9 +10,11 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_FUNCTIONAL_OVERLOAD_LINEARLY_HPP
 #define BOOST_HANA_FUNCTIONAL_OVERLOAD_LINEARLY_HPP
 
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
 
+#include <cstddef>
 #include <utility>
 
 
@@ -41,60 +43,88 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     };
 #else
-    template <typename F, typename G>
-    struct overload_linearly_t {
-        F f;
-        G g;
-
-    private:
-        template <typename ...Args, typename =
-            decltype(std::declval<F const&>()(std::declval<Args>()...))>
-        constexpr F const& which(int) const& { return f; }
-
-        template <typename ...Args, typename =
-            decltype(std::declval<F&>()(std::declval<Args>()...))>
-        constexpr F& which(int) & { return f; }
-
-        template <typename ...Args, typename =
-            decltype(std::declval<F&&>()(std::declval<Args>()...))>
-        constexpr F which(int) && { return static_cast<F&&>(f); }
-
-        template <typename ...Args>
-        constexpr G const& which(long) const& { return g; }
+    namespace detail {
+        template <typename ...>
+        struct overload_linearly_args;
+
+        // Finds the index of the first function in `F...` that can be called
+        // with `Args...`. Functions after the first viable one are never
+        // looked at, and the last function is picked when no other function
+        // can be called, which provides a useful error message.
+        template <std::size_t i, typename Args, typename ...F>
+        struct overload_linearly_which;
+
+        template <std::size_t i, typename ...Args, typename F>
+        struct overload_linearly_which<i, overload_linearly_args<Args...>, F> {
+            static constexpr std::size_t value = i;
+        };
 
-        template <typename ...Args>
-        constexpr G& which(long) & { return g; }
+        template <std::size_t i, typename ...Args, typename F, typename G, typename ...H>
+        struct overload_linearly_which<i, overload_linearly_args<Args...>, F, G, H...> {
+        private:
+            template <typename F_, typename =
+                decltype(std::declval<F_>()(std::declval<Args>()...))>
+            static constexpr std::size_t which(int) { return i; }
+
+            template <typename F_>
+            static constexpr std::size_t which(long) {
+                return overload_linearly_which<
+                    i + 1, overload_linearly_args<Args...>, G, H...
+                >::value;
+            }
+
+        public:
+            static constexpr std::size_t value = which<F>(int{});
+        };
+    }
 
-        template <typename ...Args>
-        constexpr G which(long) && { return static_cast<G&&>(g); }
+    template <typename ...F>
+    struct overload_linearly_t {
+        basic_tuple<F...> storage_;
 
-    public:
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) const&
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) const& {
+            constexpr std::size_t which = detail::overload_linearly_which<
+                0, detail::overload_linearly_args<Args...>, F const&...
+            >::value;
+            return hana::at_c<which>(storage_)(static_cast<Args&&>(args)...);
+        }
 
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) &
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) & {
+            constexpr std::size_t which = detail::overload_linearly_which<
+                0, detail::overload_linearly_args<Args...>, F&...
+            >::value;
+            return hana::at_c<which>(storage_)(static_cast<Args&&>(args)...);
+        }
 
         template <typename ...Args>
-        constexpr decltype(auto) operator()(Args&& ...args) &&
-        { return which<Args...>(int{})(static_cast<Args&&>(args)...); }
+        constexpr decltype(auto) operator()(Args&& ...args) && {
+            constexpr std::size_t which = detail::overload_linearly_which<
+                0, detail::overload_linearly_args<Args...>, F&&...
+            >::value;
+            return hana::at_c<which>(static_cast<basic_tuple<F...>&&>(storage_))(
+                static_cast<Args&&>(args)...
+            );
+        }
     };
 
     struct make_overload_linearly_t {
-        template <typename F, typename G>
-        constexpr overload_linearly_t<
-            typename detail::decay<F>::type,
-            typename detail::decay<G>::type
-        > operator()(F&& f, G&& g) const {
-            return {static_cast<F&&>(f), static_cast<G&&>(g)};
-        }
-
-        template <typename F, typename G, typename ...H>
-        constexpr decltype(auto) operator()(F&& f, G&& g, H&& ...h) const {
-            return (*this)(static_cast<F&&>(f),
-                    (*this)(static_cast<G&&>(g), static_cast<H&&>(h)...));
+        template <typename F, typename G, typename ...H,
+            typename Overload = overload_linearly_t<
+                typename detail::decay<F>::type,
+                typename detail::decay<G>::type,
+                typename detail::decay<H>::type...
+            >
+        >
+        constexpr Overload operator()(F&& f, G&& g, H&& ...h) const {
+            return Overload{
+                basic_tuple<
+                    typename detail::decay<F>::type,
+                    typename detail::decay<G>::type,
+                    typename detail::decay<H>::type...
+                >(static_cast<F&&>(f), static_cast<G&&>(g), static_cast<H&&>(h)...)
+            };
         }
 
         template <typename F>
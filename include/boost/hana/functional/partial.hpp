@@ -35,6 +35,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! The arity of `f` must match the total number of arguments passed to
     //! it, i.e. `sizeof...(x) + sizeof...(y)`.
     //!
+    //! @note
+    //! Partially applying a function that was itself created with `partial`
+    //! does not nest the function objects; the arguments are appended to the
+    //! storage of the existing partial application instead. In other words,
+    //! `partial(partial(f, x...), y...)` is stored exactly like
+    //! `partial(f, x..., y...)`, and calling it requires a single call to `f`.
+    //!
     //!
     //! Example
     //! -------
@@ -60,6 +67,46 @@ BOOST_HANA_NAMESPACE_BEGIN
         operator()(F&& f, X&& ...x) const {
             return {secret{}, static_cast<F&&>(f), static_cast<X&&>(x)...};
         }
+
+        // Partially applying a partial application appends to its storage.
+        template <std::size_t ...n, typename F, typename ...X, typename ...Y>
+        constexpr partial_t<
+            std::make_index_sequence<sizeof...(X) + sizeof...(Y)>,
+            F, X..., typename detail::decay<Y>::type...
+        >
+        operator()(partial_t<std::index_sequence<n...>, F, X...> const& p,
+                   Y&& ...y) const
+        {
+            return {secret{}, hana::at_c<0>(p.storage_),
+                              hana::at_c<n+1>(p.storage_)...,
+                              static_cast<Y&&>(y)...};
+        }
+
+        template <std::size_t ...n, typename F, typename ...X, typename ...Y>
+        constexpr partial_t<
+            std::make_index_sequence<sizeof...(X) + sizeof...(Y)>,
+            F, X..., typename detail::decay<Y>::type...
+        >
+        operator()(partial_t<std::index_sequence<n...>, F, X...>& p,
+                   Y&& ...y) const
+        {
+            return {secret{}, hana::at_c<0>(p.storage_),
+                              hana::at_c<n+1>(p.storage_)...,
+                              static_cast<Y&&>(y)...};
+        }
+
+        template <std::size_t ...n, typename F, typename ...X, typename ...Y>
+        constexpr partial_t<
+            std::make_index_sequence<sizeof...(X) + sizeof...(Y)>,
+            F, X..., typename detail::decay<Y>::type...
+        >
+        operator()(partial_t<std::index_sequence<n...>, F, X...>&& p,
+                   Y&& ...y) const
+        {
+            return {secret{}, static_cast<F&&>(hana::at_c<0>(p.storage_)),
+                              static_cast<X&&>(hana::at_c<n+1>(p.storage_))...,
+                              static_cast<Y&&>(y)...};
+        }
     };
 
     template <std::size_t ...n, typename F, typename ...X>
@@ -12,10 +12,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/config.hpp>
-#include <boost/hana/detail/create.hpp>
 #include <boost/hana/detail/decay.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -56,11 +56,32 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! - Member access: `*` (dereference), `[]` (array subscript)
     //! - Other: `()` (function call)
     //!
-    //! More complex functionality like the ability to compose placeholders
-    //! into larger function objects inline are not supported. This is on
-    //! purpose; you should either use C++14 generic lambdas or a library
-    //! like [Boost.Phoenix][] if you need bigger guns. The goal here is
-    //! to save you a couple of characters in simple situations.
+    //! Functions of a single argument created with `_` can be further
+    //! combined with values using the operators above, which applies the
+    //! operators one after the other. For example, `_ * 2 + 1` is a
+    //! function computing `x * 2 + 1`. Such chains are represented by a
+    //! single function object holding all the operands, not by nested
+    //! function objects:
+    //! @code
+    //!     ((_ @ x) # y)(z) == (z @ x) # y
+    //!     (y # (_ @ x))(z) == y # (z @ x)
+    //! @endcode
+    //!
+    //! More complex functionality like the ability to combine several
+    //! placeholders into larger function objects inline (e.g. `_ + _ * _`)
+    //! is not supported. This is on purpose; you should either use C++14
+    //! generic lambdas or a library like [Boost.Phoenix][] if you need bigger
+    //! guns. The goal here is to save you a couple of characters in simple
+    //! situations.
+    //!
+    //! ### Capturing by reference
+    //! The operands of the functions created with `_` are copied into the
+    //! function object by default, which is always safe. When an operand is
+    //! expensive to copy and known to outlive the function object, it can be
+    //! captured by reference instead by wrapping it with `hana::cref`:
+    //! @code
+    //!     hana::find_if(xs, _ == hana::cref(key)) // does not copy `key`
+    //! @endcode
     //!
     //! ### Example
     //! @include example/functional/placeholder.cpp
@@ -70,6 +91,47 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr unspecified _{};
 #else
     namespace placeholder_detail {
+        template <typename T>
+        struct cref_wrapper {
+            T const& ref;
+        };
+
+        // capture<X>:
+        //  Computes the type used to store an operand of type `X` inside a
+        //  function object created with `_`, and returns what to initialize
+        //  it with. Operands are stored by value, except when they are
+        //  wrapped with `hana::cref`, in which case a reference is stored.
+        template <typename X, typename = typename detail::decay<X>::type>
+        struct capture {
+            using type = typename detail::decay<X>::type;
+
+            static constexpr X&& get(X&& x)
+            { return static_cast<X&&>(x); }
+        };
+
+        template <typename X, typename T>
+        struct capture<X, cref_wrapper<T>> {
+            using type = T const&;
+
+            static constexpr T const& get(cref_wrapper<T> const& x)
+            { return x.ref; }
+        };
+
+        template <template <typename ...> class F>
+        struct create {
+            template <typename X>
+            constexpr F<typename capture<X>::type> operator()(X&& x) const {
+                return F<typename capture<X>::type>{
+                    capture<X>::get(static_cast<X&&>(x))
+                };
+            }
+        };
+
+        // Whether a type is a function object of one argument created with
+        // `_`, which can be combined further with other operators.
+        template <typename T>
+        struct is_expression : std::false_type { };
+
         template <typename I>
         struct subscript {
             I i;
@@ -87,9 +149,12 @@ BOOST_HANA_NAMESPACE_BEGIN
             template <typename Xs, typename ...Z>
             constexpr auto operator()(Xs&& xs, Z const& ...) &&
                 -> decltype(static_cast<Xs&&>(xs)[std::declval<I>()])
-            { return static_cast<Xs&&>(xs)[std::move(i)]; }
+            { return static_cast<Xs&&>(xs)[static_cast<I&&>(i)]; }
         };
 
+        template <typename I>
+        struct is_expression<subscript<I>> : std::true_type { };
+
         template <typename F, typename Xs, std::size_t ...i>
         constexpr decltype(auto) invoke_impl(F&& f, Xs&& xs, std::index_sequence<i...>) {
             return static_cast<F&&>(f)(hana::at_c<i>(static_cast<Xs&&>(xs).storage_)...);
@@ -103,12 +168,12 @@ BOOST_HANA_NAMESPACE_BEGIN
 
             template <typename X>
             constexpr decltype(auto) operator[](X&& x) const
-            { return detail::create<subscript>{}(static_cast<X&&>(x)); }
+            { return placeholder_detail::create<subscript>{}(static_cast<X&&>(x)); }
 
             template <typename ...X>
-            constexpr invoke<typename detail::decay<X>::type...>
+            constexpr invoke<typename capture<X>::type...>
             operator()(X&& ...x) const {
-                return {secret{}, static_cast<X&&>(x)...};
+                return {secret{}, capture<X>::get(static_cast<X&&>(x))...};
             }
         };
 
@@ -146,6 +211,134 @@ BOOST_HANA_NAMESPACE_BEGIN
             }
         };
 
+        template <typename ...X>
+        struct is_expression<invoke<X...>> : std::true_type { };
+
+        //////////////////////////////////////////////////////////////////////
+        // pipeline
+        //
+        // Function object applying several functions of one argument created
+        // with `_` one after the other. It is created when such a function
+        // is combined with another operator, like in `_ * 2 + 1`, and it
+        // keeps all the steps in a single flat storage, so that longer
+        // chains do not create deeper nestings of function objects.
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t i, std::size_t n>
+        struct run_steps {
+            template <typename Steps, typename X>
+            static constexpr auto apply(Steps&& steps, X&& x) -> decltype(
+                run_steps<i + 1, n>::apply(
+                    static_cast<Steps&&>(steps),
+                    hana::at_c<i>(static_cast<Steps&&>(steps))(static_cast<X&&>(x))
+                )
+            ) {
+                return run_steps<i + 1, n>::apply(
+                    static_cast<Steps&&>(steps),
+                    hana::at_c<i>(static_cast<Steps&&>(steps))(static_cast<X&&>(x))
+                );
+            }
+        };
+
+        template <std::size_t n>
+        struct run_steps<n, n> {
+            template <typename Steps, typename X>
+            static constexpr X apply(Steps&&, X&& x)
+            { return static_cast<X&&>(x); }
+        };
+
+        template <typename ...Steps>
+        struct pipeline {
+            basic_tuple<Steps...> steps_;
+
+            using Run = run_steps<1, sizeof...(Steps)>;
+
+            template <typename X, typename ...Z>
+            constexpr auto operator()(X&& x, Z const& ...z) const& -> decltype(
+                Run::apply(std::declval<basic_tuple<Steps...> const&>(),
+                    hana::at_c<0>(std::declval<basic_tuple<Steps...> const&>())(
+                        static_cast<X&&>(x), z...))
+            ) {
+                return Run::apply(steps_,
+                    hana::at_c<0>(steps_)(static_cast<X&&>(x), z...));
+            }
+
+            template <typename X, typename ...Z>
+            constexpr auto operator()(X&& x, Z const& ...z) & -> decltype(
+                Run::apply(std::declval<basic_tuple<Steps...>&>(),
+                    hana::at_c<0>(std::declval<basic_tuple<Steps...>&>())(
+                        static_cast<X&&>(x), z...))
+            ) {
+                return Run::apply(steps_,
+                    hana::at_c<0>(steps_)(static_cast<X&&>(x), z...));
+            }
+
+            template <typename X, typename ...Z>
+            constexpr auto operator()(X&& x, Z const& ...z) && -> decltype(
+                Run::apply(std::declval<basic_tuple<Steps...>>(),
+                    hana::at_c<0>(std::declval<basic_tuple<Steps...>>())(
+                        static_cast<X&&>(x), z...))
+            ) {
+                return Run::apply(static_cast<basic_tuple<Steps...>&&>(steps_),
+                    hana::at_c<0>(static_cast<basic_tuple<Steps...>&&>(steps_))(
+                        static_cast<X&&>(x), z...));
+            }
+        };
+
+        template <typename ...Steps>
+        struct is_expression<pipeline<Steps...>> : std::true_type { };
+
+        // then(e, step):
+        //  Returns a pipeline applying `e`, and then `step`.
+        template <typename E>
+        struct then_impl {
+            template <typename Expr, typename Step>
+            static constexpr auto apply(Expr&& e, Step&& step) {
+                using Steps = basic_tuple<E, typename detail::decay<Step>::type>;
+                return pipeline<E, typename detail::decay<Step>::type>{
+                    Steps(static_cast<Expr&&>(e), static_cast<Step&&>(step))
+                };
+            }
+        };
+
+        template <typename ...S>
+        struct then_impl<pipeline<S...>> {
+            template <typename Pipeline, typename Step, std::size_t ...i>
+            static constexpr auto
+            apply_impl(Pipeline&& p, Step&& step, std::index_sequence<i...>) {
+                using Steps = basic_tuple<S..., typename detail::decay<Step>::type>;
+                return pipeline<S..., typename detail::decay<Step>::type>{
+                    Steps(hana::at_c<i>(static_cast<Pipeline&&>(p).steps_)...,
+                          static_cast<Step&&>(step))
+                };
+            }
+
+            template <typename Pipeline, typename Step>
+            static constexpr auto apply(Pipeline&& p, Step&& step) {
+                return apply_impl(static_cast<Pipeline&&>(p),
+                                  static_cast<Step&&>(step),
+                                  std::make_index_sequence<sizeof...(S)>{});
+            }
+        };
+
+        template <typename E, typename Step>
+        constexpr auto then(E&& e, Step&& step) {
+            return then_impl<typename detail::decay<E>::type>::apply(
+                static_cast<E&&>(e), static_cast<Step&&>(step)
+            );
+        }
+
+        template <typename X>
+        using enable_if_expression = typename std::enable_if<
+            is_expression<typename detail::decay<X>::type>::value
+        >::type;
+
+        template <typename X, typename Y>
+        using enable_if_expression_and_operand = typename std::enable_if<
+            is_expression<typename detail::decay<X>::type>::value &&
+            !is_expression<typename detail::decay<Y>::type>::value &&
+            !std::is_same<typename detail::decay<Y>::type, placeholder>::value
+        >::type;
+
 #define BOOST_HANA_PLACEHOLDER_BINARY_OP(op, op_name)                           \
     template <typename X>                                                       \
     struct op_name ## _left {                                                   \
@@ -164,9 +357,12 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Y, typename ...Z>                                    \
         constexpr auto operator()(Y&& y, Z const& ...) && -> decltype(          \
             std::declval<X>() op static_cast<Y&&>(y))                           \
-        { return std::move(x) op static_cast<Y&&>(y); }                         \
+        { return static_cast<X&&>(x) op static_cast<Y&&>(y); }                  \
     };                                                                          \
                                                                                 \
+    template <typename X>                                                       \
+    struct is_expression<op_name ## _left<X>> : std::true_type { };            \
+                                                                                \
     template <typename Y>                                                       \
     struct op_name ## _right {                                                  \
         Y y;                                                                    \
@@ -184,9 +380,12 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename X, typename ...Z>                                    \
         constexpr auto operator()(X&& x, Z const& ...) && -> decltype(          \
             static_cast<X&&>(x) op std::declval<Y>())                           \
-        { return static_cast<X&&>(x) op std::move(y); }                         \
+        { return static_cast<X&&>(x) op static_cast<Y&&>(y); }                  \
     };                                                                          \
                                                                                 \
+    template <typename Y>                                                       \
+    struct is_expression<op_name ## _right<Y>> : std::true_type { };           \
+                                                                                \
     struct op_name {                                                            \
         template <typename X, typename Y, typename ...Z>                        \
         constexpr auto operator()(X&& x, Y&& y, Z const& ...) const -> decltype(\
@@ -196,14 +395,28 @@ BOOST_HANA_NAMESPACE_BEGIN
                                                                                 \
     template <typename X>                                                       \
     constexpr decltype(auto) operator op (X&& x, placeholder)                   \
-    { return detail::create<op_name ## _left>{}(static_cast<X&&>(x)); }         \
+    { return create<op_name ## _left>{}(static_cast<X&&>(x)); }                 \
                                                                                 \
     template <typename Y>                                                       \
     constexpr decltype(auto) operator op (placeholder, Y&& y)                   \
-    { return detail::create<op_name ## _right>{}(static_cast<Y&&>(y)); }        \
+    { return create<op_name ## _right>{}(static_cast<Y&&>(y)); }                \
                                                                                 \
     inline constexpr decltype(auto) operator op (placeholder, placeholder)      \
     { return op_name{}; }                                                       \
+                                                                                \
+    template <typename E, typename Y,                                           \
+              typename = enable_if_expression_and_operand<E, Y>>                \
+    constexpr auto operator op (E&& e, Y&& y) {                                 \
+        return placeholder_detail::then(static_cast<E&&>(e),                    \
+            create<op_name ## _right>{}(static_cast<Y&&>(y)));                  \
+    }                                                                           \
+                                                                                \
+    template <typename X, typename E,                                           \
+              typename = enable_if_expression_and_operand<E, X>, typename = void>\
+    constexpr auto operator op (X&& x, E&& e) {                                 \
+        return placeholder_detail::then(static_cast<E&&>(e),                    \
+            create<op_name ## _left>{}(static_cast<X&&>(x)));                   \
+    }                                                                           \
 /**/
 
 #define BOOST_HANA_PLACEHOLDER_UNARY_OP(op, op_name)                        \
@@ -216,6 +429,13 @@ BOOST_HANA_NAMESPACE_BEGIN
                                                                             \
     inline constexpr decltype(auto) operator op (placeholder)               \
     { return op_name{}; }                                                   \
+                                                                            \
+    template <>                                                             \
+    struct is_expression<op_name> : std::true_type { };                     \
+                                                                            \
+    template <typename E, typename = enable_if_expression<E>>               \
+    constexpr auto operator op (E&& e)                                      \
+    { return placeholder_detail::then(static_cast<E&&>(e), op_name{}); }    \
 /**/
             // Arithmetic
             BOOST_HANA_PLACEHOLDER_UNARY_OP(+, unary_plus)
@@ -258,6 +478,35 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     constexpr placeholder_detail::placeholder _{};
 #endif
+
+    //! @ingroup group-functional
+    //! Marks an operand of a function created with `_` to be captured by
+    //! reference instead of being copied.
+    //!
+    //! Specifically, `_ @ cref(x)` and `cref(x) @ _` create function objects
+    //! holding a reference to `x` instead of a copy of it. The same goes for
+    //! the arguments of `_(args...)` and for `_[cref(i)]`. It is the caller's
+    //! responsibility to make sure that `x` outlives the function object;
+    //! hence, temporaries can't be captured by reference.
+    //!
+    //! ### Example
+    //! @include example/functional/placeholder.cref.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto cref = [](auto const& x) {
+        return unspecified-reference-marker;
+    };
+#else
+    struct cref_t {
+        template <typename T>
+        constexpr placeholder_detail::cref_wrapper<T> operator()(T const& x) const
+        { return {x}; }
+
+        template <typename T>
+        void operator()(T const&&) const = delete;
+    };
+
+    constexpr cref_t cref{};
+#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FUNCTIONAL_PLACEHOLDER_HPP
@@ -0,0 +1,149 @@
+/*!
+@file
+Forward declares `boost::hana::bitset`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_BITSET_HPP
+#define BOOST_HANA_FWD_BITSET_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+
+#include <cstdint>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Set of small non-negative `IntegralConstant`s represented as a bit mask.
+    //!
+    //! A `hana::bitset` holds `integral_constant`s of the same type `T`, like
+    //! a `hana::set` of such constants would. However, instead of storing the
+    //! keys as elements of a tuple, membership is encoded in the bits of a
+    //! sequence of `std::uint64_t` template parameters, where the bit `k`
+    //! is set if and only if `integral_c<T, k>` is in the set. Hence, set
+    //! algebra on bitsets (`union_`, `intersection`, `difference`, etc.) only
+    //! requires some constexpr arithmetic on a few words, instead of searching
+    //! through the elements of the sets and creating new tuples.
+    //!
+    //! This makes bitsets well suited for sets of small integral keys like
+    //! feature flags or indices. Since the size of a bitset is proportional
+    //! to its largest key, the keys should be small, and they can't be
+    //! negative.
+    //!
+    //! @note
+    //! The representation of a bitset is canonical, i.e. two bitsets holding
+    //! the same keys of the same type `T` always have the same C++ type. The
+    //! canonical way of creating a `hana::bitset` is through `hana::bitset_c`
+    //! or `hana::make_bitset`.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable`\n
+    //! Two bitsets are equal iff they contain the same keys, regardless of
+    //! the type of their keys. The result is a compile-time `Logical`.
+    //!
+    //! 2. `Foldable`\n
+    //! Folding a bitset is equivalent to folding the sequence of its keys,
+    //! which are `integral_constant<T, k>`s in increasing order of `k`.
+    //!
+    //! 3. `Searchable`\n
+    //! The keys of a bitset act as both its keys and its values, like for
+    //! `hana::set`. Looking up an `IntegralConstant` with `contains` or
+    //! `find` only tests a bit. `operator[]` can be used instead of `at_key`.
+    //!
+    //!
+    //! Set operations
+    //! --------------
+    //! `insert`, `erase_key`, `union_`, `intersection`, `difference`,
+    //! `symmetric_difference` and `is_subset` are provided for bitsets, with
+    //! the same semantics as for `hana::set`. The keys passed to `insert` and
+    //! `erase_key` must be non-negative `IntegralConstant`s. The result of a
+    //! binary operation uses the common type of the keys of both bitsets.
+    //!
+    //!
+    //! Conversions
+    //! -----------
+    //! A bitset can be converted to a `hana::set` with `to<set_tag>`, and any
+    //! `Foldable` of non-negative `IntegralConstant`s (including a `hana::set`)
+    //! can be converted to a bitset with `to<bitset_tag>`. Duplicate keys are
+    //! ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/bitset/set_algebra.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T, implementation_defined>
+    struct bitset {
+        //! The type of the keys of the bitset.
+        using value_type = T;
+
+        //! The number of keys in the bitset.
+        static constexpr std::size_t size = implementation_defined;
+
+        //! Equivalent to `hana::equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator==(X&& x, Y&& y);
+
+        //! Equivalent to `hana::not_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator!=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::at_key`
+        template <typename Key>
+        constexpr decltype(auto) operator[](Key&& key);
+    };
+#else
+    template <typename T, std::uint64_t ...Words>
+    struct bitset;
+#endif
+
+    //! Tag representing the `hana::bitset` container.
+    //! @relates hana::bitset
+    struct bitset_tag { };
+
+    //! Function object for creating a `hana::bitset`.
+    //! @relates hana::bitset
+    //!
+    //! Given zero or more non-negative `IntegralConstant`s, `make<bitset_tag>`
+    //! returns a bitset containing those keys. The type of the keys of the
+    //! bitset is the common type of the values of the constants, or `int`
+    //! if no keys are provided. Duplicate keys are allowed, and ignored.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <>
+    constexpr auto make<bitset_tag> = [](auto&& ...keys) {
+        return bitset<implementation_defined>{};
+    };
+#endif
+
+    //! Equivalent to `make<bitset_tag>`; provided for convenience.
+    //! @relates hana::bitset
+    constexpr auto make_bitset = make<bitset_tag>;
+
+    //! Create a `hana::bitset` containing the keys `integral_c<T, v>...`.
+    //! @relates hana::bitset
+    //!
+    //! This is functionally equivalent to
+    //! `make<bitset_tag>(integral_c<T, v>...)`, except that it is cheaper to
+    //! compile since the keys are already known as values.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T, T ...v>
+    constexpr bitset<T, implementation_defined> bitset_c{};
+#else
+    namespace bitset_detail {
+        template <typename T, T ...v>
+        struct from_keys;
+    }
+
+    template <typename T, T ...v>
+    constexpr typename bitset_detail::from_keys<T, v...>::type bitset_c{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_BITSET_HPP
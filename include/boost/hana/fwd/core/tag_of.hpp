@@ -92,7 +92,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //!
     //! > __Tip 2__\n
     //! > Consider using `tag_of_t` alias instead of `tag_of`, which
-    //! > reduces the amount of typing in dependent contexts.
+    //! > reduces the amount of typing in dependent contexts. It also strips
+    //! > the references and cv-qualifiers of `T` in a single step before
+    //! > looking up the tag, so all the variants of a type share a single
+    //! > instantiation of `tag_of`.
     //!
     //!
     //! Example
@@ -113,8 +116,32 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! Example
     //! -------
     //! @include example/core/tag_of_t.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
     template <typename T>
     using tag_of_t = typename hana::tag_of<T>::type;
+#else
+    namespace core_detail {
+        // Strips all the references and cv-qualifiers of a type with a
+        // single instantiation, unlike std::remove_cv<std::remove_reference>.
+        template <typename T> struct remove_cv_ref { using type = T; };
+        template <typename T> struct remove_cv_ref<T const> { using type = T; };
+        template <typename T> struct remove_cv_ref<T volatile> { using type = T; };
+        template <typename T> struct remove_cv_ref<T const volatile> { using type = T; };
+        template <typename T> struct remove_cv_ref<T&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T const&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T volatile&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T const volatile&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T&&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T const&&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T volatile&&> { using type = T; };
+        template <typename T> struct remove_cv_ref<T const volatile&&> { using type = T; };
+    }
+
+    template <typename T>
+    using tag_of_t = typename hana::tag_of<
+        typename core_detail::remove_cv_ref<T>::type
+    >::type;
+#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FWD_CORE_TAG_OF_HPP
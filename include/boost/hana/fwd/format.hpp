@@ -0,0 +1,83 @@
+/*!
+@file
+Forward declares `boost::hana::format` and `boost::hana::formatter`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FORMAT_HPP
+#define BOOST_HANA_FWD_FORMAT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/string.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Formats values into a character buffer according to a compile-time
+    //! format string.
+    //!
+    //! A `hana::formatter` is created from a `hana::string` with
+    //! `hana::format`. The format string is made of characters that are
+    //! written as-is, and of `{}` placeholders that are replaced by the
+    //! arguments, in order. `{{` and `}}` are written as `{` and `}`.
+    //!
+    //! The format string is parsed once, at compile-time, into a plan made
+    //! of the literal text between the placeholders. Formatting arguments
+    //! then writes the pieces of literal text and the arguments one after
+    //! the other, without parsing anything at runtime. The number of
+    //! arguments is checked against the number of placeholders at
+    //! compile-time, and a malformed format string (an unmatched `{` or
+    //! `}`) triggers a compile-time error.
+    //!
+    //! Formatting does not allocate, does not use iostreams and does not
+    //! depend on the locale. The following arguments are supported:
+    //! - `bool`, written as `true` or `false`
+    //! - `char`, written as a single character
+    //! - integral types, written in decimal
+    //! - floating point types, written with `std::to_chars`, i.e. with the
+    //!   shortest representation that reads back as the same value. These
+    //!   are only supported when the standard library provides
+    //!   `std::to_chars` for floating point types (usually from C++17 on);
+    //!   otherwise, formatting one is a compile-time error
+    //! - `char const*`, which must point to a null-terminated string
+    //! - `hana::string`s
+    //! - objects `s` with `s.data()` and `s.size()` members, like
+    //!   `std::string`s
+    //!
+    //!
+    //! Formatting
+    //! ----------
+    //! A `hana::formatter` `f` is called as `f(first, last, args...)`, where
+    //! `[first, last)` is the buffer to write to. It returns a pointer to the
+    //! character following the last character that was written, or `nullptr`
+    //! if the buffer is too small, in which case its contents are unspecified.
+    //! No null terminator is written.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/format.cpp
+    template <char ...s>
+    struct formatter;
+
+    //! Creates a `hana::formatter` from a `hana::string`.
+    //! @relates hana::formatter
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto format = [](auto const& str) {
+        return formatter<implementation_defined>{};
+    };
+#else
+    struct format_t {
+        template <char ...s>
+        constexpr formatter<s...> operator()(hana::string<s...> const&) const
+        { return {}; }
+    };
+
+    constexpr format_t format{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FORMAT_HPP
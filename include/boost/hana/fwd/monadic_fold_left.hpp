@@ -105,6 +105,35 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename M>
     constexpr monadic_fold_left_t<M> monadic_fold_left{};
 #endif
+
+    //! Extension point allowing monadic folds to stop as soon as the state
+    //! of the fold can't change anymore.
+    //! @ingroup group-Foldable
+    //!
+    //! By default, `monadic_fold_left<M>` and `monadic_fold_right<M>` chain
+    //! a continuation built over all the elements of the structure, so every
+    //! element is processed at compile-time even when an early step makes
+    //! the rest of the fold irrelevant, for example when it returns
+    //! `hana::nothing` in the `optional` Monad.
+    //!
+    //! A Monad `M` can avoid this by specializing `monadic_fold_stop_impl<M>`
+    //! with a static function `apply(m)` that returns a boolean `Constant`.
+    //! This `Constant` must be true if and only if, for any function `f`,
+    //! `hana::chain(m, f)` returns `m` without calling `f`. For such a Monad,
+    //! monadic folds chain each step to the state as soon as it is computed,
+    //! and return the state as soon as `apply(state)` is true, without
+    //! looking at the remaining elements. By the associativity of `chain`,
+    //! this gives the same result as the default implementation.
+    //!
+    //! This is provided for `hana::optional`, for which `apply(m)` is true
+    //! if and only if `m` is `hana::nothing`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/monadic_fold_stop.cpp
+    template <typename M, typename = void>
+    struct monadic_fold_stop_impl : monadic_fold_stop_impl<M, when<true>> { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FWD_MONADIC_FOLD_LEFT_HPP
@@ -0,0 +1,216 @@
+/*!
+@file
+Forward declares `boost::hana::ordered_map`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_ORDERED_MAP_HPP
+#define BOOST_HANA_FWD_ORDERED_MAP_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+#include <boost/hana/fwd/erase_key.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/keys.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Basic associative container whose entries are sorted by key.
+    //!
+    //! A `hana::ordered_map` is like a `hana::map`, except that its keys must
+    //! be compile-time `Orderable` (e.g. `IntegralConstant`s) instead of
+    //! `Hashable`, and that its entries are stored in increasing order of
+    //! their keys, as given by `hana::less`. The entries are sorted once,
+    //! when the map is created, and they stay sorted by `insert` and
+    //! `erase_key`. Hence, traversing the map in key order does not require
+    //! sorting the keys again, and looking up a key is a binary search whose
+    //! depth is logarithmic in the size of the map.
+    //!
+    //! @note
+    //! The actual representation of a `hana::ordered_map` is an
+    //! implementation detail, and only the type of its entries in sorted
+    //! order is part of the interface. The canonical way of creating an
+    //! `ordered_map` is through `hana::make_ordered_map`.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable`\n
+    //! Two ordered maps are equal iff their entries are equal, one by one.
+    //! Since entries are sorted, this is equivalent to having the same keys
+    //! associated to equal values.
+    //!
+    //! 2. `Foldable`\n
+    //! Folding an ordered map is equivalent to folding a sequence of its
+    //! entries in increasing order of their keys.
+    //!
+    //! 3. `Searchable`\n
+    //! An ordered map can be searched by its keys, like a `hana::map`. `find`,
+    //! `contains` and `at_key` do a binary search over the keys, and
+    //! `operator[]` can be used instead of `at_key`.
+    //!
+    //!
+    //! Ordered queries
+    //! ---------------
+    //! `hana::lower_bound` and `hana::upper_bound` return the position of a
+    //! key in the map as a `hana::size_t`, and `hana::slice_keys` returns the
+    //! entries whose keys are in a half-open range. `hana::keys` and
+    //! `hana::values` return the keys and the values in increasing order of
+    //! the keys.
+    //!
+    //!
+    //! Conversion from any `Foldable`
+    //! ------------------------------
+    //! Any `Foldable` of `Product`s can be converted to an ordered map with
+    //! `hana::to<hana::ordered_map_tag>` or `hana::to_ordered_map`. If the
+    //! `Foldable` contains duplicate keys, only the value associated to the
+    //! first occurence of the key is kept, like for `hana::map`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/ordered_map/ordered_map.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename ...Pairs>
+    struct ordered_map {
+        //! Default-construct all the entries of the map.
+        constexpr ordered_map() = default;
+
+        //! Copy-construct an ordered map from another one.
+        constexpr ordered_map(ordered_map const& other) = default;
+
+        //! Move-construct an ordered map from another one.
+        constexpr ordered_map(ordered_map&& other) = default;
+
+        //! Equivalent to `hana::equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator==(X&& x, Y&& y);
+
+        //! Equivalent to `hana::not_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator!=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::at_key`
+        template <typename Key>
+        constexpr decltype(auto) operator[](Key&& key);
+    };
+#else
+    template <typename ...Pairs>
+    struct ordered_map;
+#endif
+
+    //! Tag representing `hana::ordered_map`s.
+    //! @relates hana::ordered_map
+    struct ordered_map_tag { };
+
+    //! Function object for creating a `hana::ordered_map`.
+    //! @relates hana::ordered_map
+    //!
+    //! Given zero or more `Product`s representing key/value associations,
+    //! `make<ordered_map_tag>` returns an ordered map holding these entries
+    //! sorted by key. The keys must be unique and `Orderable` at
+    //! compile-time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/ordered_map/make.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <>
+    constexpr auto make<ordered_map_tag> = [](auto&& ...pairs) {
+        return ordered_map<implementation_defined>{forwarded(pairs)...};
+    };
+#endif
+
+    //! Alias to `make<ordered_map_tag>`; provided for convenience.
+    //! @relates hana::ordered_map
+    constexpr auto make_ordered_map = make<ordered_map_tag>;
+
+    //! Equivalent to `to<ordered_map_tag>`; provided for convenience.
+    //! @relates hana::ordered_map
+    constexpr auto to_ordered_map = to<ordered_map_tag>;
+
+    //! Returns the position of the first entry whose key is not less than
+    //! the given key.
+    //! @relates hana::ordered_map
+    //!
+    //! Given an ordered map and a compile-time `Orderable` key, `lower_bound`
+    //! returns a `hana::size_t` holding the number of entries whose key is
+    //! less than `key`. The search does a number of comparisons logarithmic
+    //! in the size of the map.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/ordered_map/bounds.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto lower_bound = [](auto const& map, auto const& key) {
+        return hana::size_c<implementation_defined>;
+    };
+#else
+    struct lower_bound_t {
+        template <typename Map, typename Key>
+        constexpr auto operator()(Map const& map, Key const& key) const;
+    };
+
+    constexpr lower_bound_t lower_bound{};
+#endif
+
+    //! Returns the position of the first entry whose key is greater than
+    //! the given key.
+    //! @relates hana::ordered_map
+    //!
+    //! Given an ordered map and a compile-time `Orderable` key, `upper_bound`
+    //! returns a `hana::size_t` holding the number of entries whose key is
+    //! not greater than `key`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/ordered_map/bounds.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto upper_bound = [](auto const& map, auto const& key) {
+        return hana::size_c<implementation_defined>;
+    };
+#else
+    struct upper_bound_t {
+        template <typename Map, typename Key>
+        constexpr auto operator()(Map const& map, Key const& key) const;
+    };
+
+    constexpr upper_bound_t upper_bound{};
+#endif
+
+    //! Returns the entries of an ordered map whose keys are in a half-open
+    //! range.
+    //! @relates hana::ordered_map
+    //!
+    //! Given an ordered map and two compile-time `Orderable` keys `from` and
+    //! `to`, `slice_keys` returns an ordered map holding the entries whose
+    //! key `k` satisfies `from <= k && k < to`. This only requires two
+    //! binary searches, since the entries are already sorted.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/ordered_map/slice_keys.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto slice_keys = [](auto&& map, auto const& from, auto const& to) {
+        return hana::ordered_map<implementation_defined>{...};
+    };
+#else
+    struct slice_keys_t {
+        template <typename Map, typename From, typename To>
+        constexpr auto operator()(Map&& map, From const& from, To const& to) const;
+    };
+
+    constexpr slice_keys_t slice_keys{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_ORDERED_MAP_HPP
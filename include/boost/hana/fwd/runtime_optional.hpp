@@ -0,0 +1,176 @@
+/*!
+@file
+Forward declares `boost::hana::runtime_optional`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_RUNTIME_OPTIONAL_HPP
+#define BOOST_HANA_FWD_RUNTIME_OPTIONAL_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Optional value whose optional-ness is only known at runtime.
+    //!
+    //! A `runtime_optional<T>` either contains a value of type `T`, or it is
+    //! empty. Unlike `hana::optional`, whether it contains a value is stored
+    //! inside the object, so it can be decided at runtime. This makes it
+    //! possible to express computations that might fail at runtime with the
+    //! same `transform`, `chain` and `find_if` vocabulary that is used with
+    //! `hana::optional`, without falling back to `std::optional`.
+    //!
+    //! `runtime_optional` and `hana::optional` can be mixed in the same
+    //! monadic chain. When the state of a step is known at compile-time, it
+    //! is kept in the type, and no runtime check is generated for it:
+    //! @code
+    //!     just(x)  | f  // f returns a runtime_optional: result is f(x)
+    //!     nothing  | f  // f is never called: result is nothing
+    //!     rt       | g  // g returns just(y): result is a runtime_optional
+    //!     rt       | h  // h returns nothing: result is nothing
+    //! @endcode
+    //! where `rt` is a `runtime_optional`. Hence, only the steps that are
+    //! really dynamic cost a branch.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable`\n
+    //! Two `runtime_optional`s are equal if and only if they are both empty
+    //! or they both contain a value and those values are equal. The result
+    //! is a runtime `bool`.
+    //!
+    //! 2. `Orderable`\n
+    //! Like for `hana::optional`, an empty `runtime_optional` is less than
+    //! any non-empty one, and non-empty ones are ordered by their value.
+    //!
+    //! 3. `Functor`\n
+    //! `transform(opt, f)` returns a `runtime_optional` containing `f(*opt)`
+    //! if `opt` contains a value, and an empty `runtime_optional` otherwise.
+    //!
+    //! 4. `Applicative`\n
+    //! `lift<runtime_optional_tag>(x)` creates a `runtime_optional` containing
+    //! `x`, and `ap(f, x)` contains `(*f)(*x)` if and only if both `f` and `x`
+    //! contain a value.
+    //!
+    //! 5. `Monad`\n
+    //! `chain(opt, f)` returns `f(*opt)` if `opt` contains a value, and an
+    //! empty `runtime_optional` otherwise. `f` may return a `runtime_optional`
+    //! or a `hana::optional`, as explained above. The `|` operator can be
+    //! used in place of `chain`.
+    //!
+    //! 6. `Searchable`\n
+    //! Searching a `runtime_optional` is equivalent to searching a list that
+    //! contains either nothing or its value. The predicate may return a
+    //! runtime or a compile-time `Logical`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/runtime_optional/monad.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T>
+    struct runtime_optional {
+        //! Constructs an empty `runtime_optional`.
+        constexpr runtime_optional();
+
+        //! Constructs a `runtime_optional` containing a copy of `t`.
+        constexpr runtime_optional(T const& t);
+
+        //! Constructs a `runtime_optional` containing `t`, which is moved.
+        constexpr runtime_optional(T&& t);
+
+        //! Constructs a `runtime_optional` containing the value of a
+        //! `hana::just`.
+        template <typename U>
+        constexpr runtime_optional(hana::optional<U> const& opt);
+
+        //! Constructs an empty `runtime_optional` from `hana::nothing`.
+        constexpr runtime_optional(hana::optional<> const&);
+
+        //! Returns whether the `runtime_optional` contains a value.
+        constexpr bool has_value() const;
+
+        //! Equivalent to `has_value()`.
+        constexpr explicit operator bool() const;
+
+        //! Returns the contained value. The behavior is undefined if the
+        //! `runtime_optional` is empty.
+        //! @note
+        //! Overloads of this method are provided for the cases where `*this`
+        //! is a reference, a rvalue-reference and their `const` counterparts.
+        constexpr T& value();
+
+        //! Equivalent to `value()`, provided for convenience.
+        constexpr T& operator*();
+
+        //! Returns a pointer to the contained value. The behavior is
+        //! undefined if the `runtime_optional` is empty.
+        constexpr T* operator->();
+
+        //! Returns the contained value if there is one, and `default_`
+        //! converted to `T` otherwise.
+        template <typename U>
+        constexpr T value_or(U&& default_) const&;
+
+        //! Equivalent to `hana::chain`.
+        template <typename F>
+        friend constexpr auto operator|(runtime_optional, F);
+
+        //! Equivalent to `hana::equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator==(X&& x, Y&& y);
+
+        //! Equivalent to `hana::not_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator!=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::less`
+        template <typename X, typename Y>
+        friend constexpr auto operator<(X&& x, Y&& y);
+
+        //! Equivalent to `hana::greater`
+        template <typename X, typename Y>
+        friend constexpr auto operator>(X&& x, Y&& y);
+
+        //! Equivalent to `hana::less_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator<=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::greater_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator>=(X&& x, Y&& y);
+    };
+#else
+    template <typename T>
+    struct runtime_optional;
+#endif
+
+    //! Tag representing a `hana::runtime_optional`.
+    //! @relates hana::runtime_optional
+    struct runtime_optional_tag { };
+
+    //! Create a `runtime_optional` containing the given value.
+    //! @relates hana::runtime_optional
+    //!
+    //! `make<runtime_optional_tag>(x)` returns a `runtime_optional` of the
+    //! decayed type of `x` containing `x`. An empty `runtime_optional` of
+    //! type `T` is created with `runtime_optional<T>{}`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <>
+    constexpr auto make<runtime_optional_tag> = [](auto&& x) {
+        return runtime_optional<std::decay<decltype(x)>::type>{forwarded(x)};
+    };
+#endif
+
+    //! Alias to `make<runtime_optional_tag>`; provided for convenience.
+    //! @relates hana::runtime_optional
+    constexpr auto make_runtime_optional = make<runtime_optional_tag>;
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_RUNTIME_OPTIONAL_HPP
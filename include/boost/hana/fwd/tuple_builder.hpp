@@ -0,0 +1,172 @@
+/*!
+@file
+Forward declares `boost::hana::tuple_builder`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_TUPLE_BUILDER_HPP
+#define BOOST_HANA_FWD_TUPLE_BUILDER_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Accumulator for building a `hana::tuple` one element at a time.
+    //!
+    //! Growing a `hana::tuple` element by element, for example with
+    //! `hana::fold_left(xs, hana::make_tuple(), hana::append)`, creates a
+    //! new `tuple<...>` type at each step, and each of these types has to
+    //! instantiate storage for all the elements appended so far. Building
+    //! a tuple of `n` elements this way is hence quadratic in `n`.
+    //!
+    //! A `hana::tuple_builder` is meant to be used as the state of such a
+    //! loop instead. Appending an element to a builder with `hana::push_back`
+    //! creates a builder that refers to the previous one and to the appended
+    //! element, which means that each step only instantiates a single new
+    //! link, and that nothing is moved or copied. Once all the elements have
+    //! been appended, the builder is converted to a `hana::tuple` with
+    //! `hana::to_tuple` or `hana::to<hana::tuple_tag>`, which moves or copies
+    //! each element exactly once, into the tuple. Since a builder is not a
+    //! `MonadPlus`, elements are added with `hana::push_back` instead of
+    //! `hana::append`.
+    //!
+    //! @note
+    //! Like `std::forward_as_tuple`, a builder holds references: to the
+    //! builder it extends, and to the element it appends. It must hence be
+    //! converted before any of them is destroyed, which usually means in
+    //! the expression that creates it. In particular, a builder can't be
+    //! returned from `hana::fold_left`, since the intermediate states of the
+    //! fold are destroyed before it returns; `hana::build_tuple` performs
+    //! such a fold and converts the builder while they still exist. The
+    //! elements appended as rvalues are moved into the tuple, so a builder
+    //! should only be converted once. The actual type of a
+    //! `hana::tuple_builder` is an implementation detail, except for the
+    //! empty builder `hana::tuple_builder<>`. The canonical way of creating
+    //! an empty builder is with `hana::make_tuple_builder()`.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! Folding a builder is equivalent to folding the sequence of elements
+    //! that were appended to it, in the order in which they were appended.
+    //! This makes it possible to convert a builder to any `Sequence`, but
+    //! `hana::tuple` is the only one for which the conversion is optimized.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/tuple_builder/tuple_builder.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <implementation_defined>
+    struct tuple_builder { };
+#else
+    template <typename ...Links>
+    struct tuple_builder;
+#endif
+
+    //! Tag representing `hana::tuple_builder`s.
+    //! @relates hana::tuple_builder
+    struct tuple_builder_tag { };
+
+    //! Function object for creating an empty `hana::tuple_builder`.
+    //! @relates hana::tuple_builder
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <>
+    constexpr auto make<tuple_builder_tag> = []() {
+        return tuple_builder<>{};
+    };
+#endif
+
+    //! Alias to `make<tuple_builder_tag>`; provided for convenience.
+    //! @relates hana::tuple_builder
+    constexpr auto make_tuple_builder = make<tuple_builder_tag>;
+
+    //! Returns a builder holding the elements of a builder followed by
+    //! another element.
+    //! @relates hana::tuple_builder
+    //!
+    //! Given a `hana::tuple_builder` and an object `x`, `push_back` returns
+    //! a builder holding the elements of `builder` followed by `x`, like
+    //! `hana::append` would for a `hana::tuple`. Neither `builder` nor `x`
+    //! is copied; the result refers to both of them, and `x` is moved into
+    //! the tuple the builder is eventually converted to if it is an rvalue.
+    //! The signature of `push_back` is suitable for use as the function of
+    //! `hana::build_tuple`.
+    //!
+    //! > #### Rationale for calling this `push_back`
+    //! > Unlike `hana::append`, this is not a `MonadPlus` operation, and it
+    //! > is only meant to be used on an accumulator, in a loop that would
+    //! > mutate it at runtime. A different name makes it clear that the
+    //! > argument must be a builder.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/tuple_builder/push_back.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto push_back = [](auto&& builder, auto&& x) {
+        return tuple_builder<implementation_defined>{
+            forwarded(builder), forwarded(x)
+        };
+    };
+#else
+    struct push_back_t {
+        template <typename Builder, typename X>
+        constexpr auto operator()(Builder&& builder, X&& x) const;
+    };
+
+    constexpr push_back_t push_back{};
+#endif
+
+    //! Builds a `hana::tuple` by folding a function over a structure with
+    //! a `hana::tuple_builder` as the state.
+    //! @relates hana::tuple_builder
+    //!
+    //! Given a `Foldable` structure `xs` and a function `f`, `build_tuple`
+    //! folds `f` over `xs` from the left, starting with an empty builder,
+    //! and converts the resulting builder to a `hana::tuple`. This is
+    //! equivalent to
+    //! @code
+    //!     hana::to_tuple(hana::fold_left(xs, hana::make_tuple_builder(), f))
+    //! @endcode
+    //! except that the intermediate builders are still alive when the result
+    //! is converted, which is required since each builder refers to the
+    //! previous one.
+    //!
+    //!
+    //! @param xs
+    //! The structure to fold.
+    //!
+    //! @param f
+    //! A function called as `f(builder, x)` for each element `x` of `xs`,
+    //! and returning `builder` with some elements appended with
+    //! `hana::push_back`. Since the result refers to the appended objects,
+    //! these must outlive the call to `build_tuple`, like `x` itself does.
+    //! Hence, `f` may push `x` or parts of it, but not objects that it
+    //! creates itself.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/tuple_builder/build_tuple.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto build_tuple = [](auto&& xs, auto const& f) {
+        return to_tuple(fold_left(forwarded(xs), make_tuple_builder(), f));
+    };
+#else
+    struct build_tuple_t {
+        template <typename Xs, typename F>
+        constexpr auto operator()(Xs&& xs, F const& f) const;
+    };
+
+    constexpr build_tuple_t build_tuple{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_TUPLE_BUILDER_HPP
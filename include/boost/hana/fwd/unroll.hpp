@@ -0,0 +1,75 @@
+/*!
+@file
+Forward declares `boost::hana::unroll`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_UNROLL_HPP
+#define BOOST_HANA_FWD_UNROLL_HPP
+
+#include <boost/hana/config.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function with the indices `0, stride, 2 * stride, ...` below
+    //! `N`, unrolling the calls in blocks of `Block` indices.
+    //!
+    //! `hana::unroll<N>(f)` calls `f` with the same indices as
+    //! `hana::for_each(hana::range_c<std::size_t, 0, N>, f)`, except that
+    //! the calls are made directly instead of through `unpack` and a
+    //! variadic lambda, and the functions performing them are marked to be
+    //! always inlined. This makes it suitable as an "unroll N" primitive in
+    //! numeric kernels, for which compilers tend to stop inlining the body
+    //! of `hana::for_each` once `N` grows large.
+    //!
+    //! With `hana::unroll<N, Block>(f)`, only `Block` calls are unrolled, and
+    //! the blocks are executed by a runtime loop. The iterations that do not
+    //! fill a whole block are unrolled after that loop. This bounds the size
+    //! of the generated code while keeping the body of each block visible to
+    //! the optimizer, e.g. for vectorization.
+    //!
+    //!
+    //! @tparam N
+    //! The number of indices to iterate over, i.e. iteration stops before
+    //! the first index greater than or equal to `N`.
+    //!
+    //! @tparam Block
+    //! The number of calls to `f` in each block. It defaults to `N`, in
+    //! which case everything is unrolled. `Block` must be positive.
+    //!
+    //! @param stride
+    //! An optional `hana::size_t` holding the distance between consecutive
+    //! indices. It defaults to `hana::size_c<1>`, and it must be positive.
+    //!
+    //! @param f
+    //! A function called as `f(i, k)` for each index, where `i` is the index
+    //! as a `std::size_t`, and `k` is a `hana::size_t` holding the offset of
+    //! the index in its block. Hence, `i == start + k` where `start` is the
+    //! first index of the block, and `k` can be used wherever a compile-time
+    //! index is needed. When everything is unrolled, there is only one block
+    //! and `k` is the index itself. The result of `f` is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/unroll.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <std::size_t N, std::size_t Block = N>
+    constexpr auto unroll = [](auto&& ...stride_and_f) -> void {
+        unspecified;
+    };
+#else
+    template <std::size_t N, std::size_t Block>
+    struct unroll_t;
+
+    template <std::size_t N, std::size_t Block = N>
+    constexpr unroll_t<N, Block> unroll{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_UNROLL_HPP
@@ -31,6 +31,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
+#include <boost/hana/detail/type_at.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/first.hpp>
@@ -45,6 +46,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/is_subset.hpp>
 #include <boost/hana/fwd/keys.hpp>
+#include <boost/hana/fwd/pair.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/integral_constant.hpp>
@@ -192,10 +194,28 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
         //! @endcond
 
+        // Returns the type of the key of a map entry. For `hana::pair`s, this
+        // is done without instantiating `hana::first` or `hana::at_c`, since
+        // the key of every entry is needed to build the hash table.
+        template <typename Pair>
+        struct map_key {
+            using type = decltype(hana::first(std::declval<Pair>()));
+        };
+
+        template <typename Key, typename Value>
+        struct map_key<hana::pair<Key, Value>> {
+            using type = Key;
+        };
+
         template <typename Storage>
-        struct KeyAtIndex {
+        struct KeyAtIndex;
+
+        template <typename ...Pairs>
+        struct KeyAtIndex<hana::basic_tuple<Pairs...>> {
             template <std::size_t i>
-            using apply = decltype(hana::first(hana::at_c<i>(std::declval<Storage>())));
+            using apply = typename detail::map_key<
+                typename detail::type_at<i, Pairs...>::type
+            >::type;
         };
 
         template <typename ...Pairs>
@@ -232,9 +252,6 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_map(pairs...) requires all the keys to be "
             "Comparable at compile-time");
 
-            //! @todo
-            //! This can be implemented more efficiently by doing the check
-            //! inside each bucket instead.
             static_assert(!detail::has_duplicates<decltype(hana::first(pairs))...>::value,
             "hana::make_map({keys, values}...) requires all the keys to be unique");
 
@@ -243,7 +260,7 @@ BOOST_HANA_NAMESPACE_BEGIN
 #endif
 
             using Map = typename detail::make_map_type<typename detail::decay<Pairs>::type...>::type;
-            return Map{hana::make_basic_tuple(static_cast<Pairs&&>(pairs)...)};
+            return Map{static_cast<Pairs&&>(pairs)...};
         }
     };
 
@@ -15,11 +15,17 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/less.hpp>
 
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -89,8 +95,27 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename T, bool condition>
     struct minimum_impl<T, when<condition>> : default_ {
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs)
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, detail::not_integral_elements)
         { return hana::minimum(static_cast<Xs&&>(xs), hana::less); }
+
+        // When all the elements are `integral_constant`s of the same type,
+        // the minimum is found with a single loop over their values.
+        template <typename Xs, typename V, V ...v>
+        static constexpr auto apply_impl(Xs&&, std::integer_sequence<V, v...>) {
+            constexpr V values[] = {v...};
+            return hana::integral_c<V,
+                *detail::min_element(values, values + sizeof...(v))
+            >;
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using Elements = typename detail::integral_elements<
+                typename detail::decay<Xs>::type
+            >::type;
+            return minimum_impl::apply_impl(static_cast<Xs&&>(xs), Elements{});
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
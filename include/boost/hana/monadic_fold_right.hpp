@@ -12,12 +12,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/monadic_fold_right.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/chain.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/concept/monad.hpp>
 #include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/monadic_fold_stop.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/curry.hpp>
 #include <boost/hana/functional/partial.hpp>
@@ -101,7 +104,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct monadic_fold_right_impl<T, when<condition>> : default_ {
         // with state
         template <typename M, typename Xs, typename S, typename F>
-        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+        static constexpr decltype(auto) apply_impl(Xs&& xs, S&& s, F&& f, hana::false_) {
             return hana::fold_left(
                 static_cast<Xs&&>(xs),
                 hana::lift<M>,
@@ -111,6 +114,23 @@ BOOST_HANA_NAMESPACE_BEGIN
             )(static_cast<S&&>(s));
         }
 
+        template <typename M, typename Xs, typename S, typename F>
+        static constexpr auto apply_impl(Xs&& xs, S&& s, F&& f, hana::true_) {
+            return detail::monadic_fold_stop_apply<M, false>(
+                static_cast<Xs&&>(xs),
+                hana::lift<M>(static_cast<S&&>(s)),
+                f
+            );
+        }
+
+        template <typename M, typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return monadic_fold_right_impl::apply_impl<M>(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s), static_cast<F&&>(f),
+                hana::bool_c<!is_default<monadic_fold_stop_impl<M>>::value>
+            );
+        }
+
         // without state
         template <typename M, typename Xs, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
@@ -32,6 +32,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/flatten.hpp>
 #include <boost/hana/fwd/less.hpp>
 #include <boost/hana/fwd/lift.hpp>
+#include <boost/hana/fwd/monadic_fold_left.hpp>
+#include <boost/hana/fwd/runtime_optional.hpp>
 #include <boost/hana/fwd/transform.hpp>
 #include <boost/hana/fwd/type.hpp>
 #include <boost/hana/fwd/unpack.hpp>
@@ -304,6 +306,27 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename T>
         static constexpr auto apply(optional<optional<T>>&& opt)
         { return hana::just(static_cast<T&&>(opt.value_.value_)); }
+
+        // Optional values whose state is only known at runtime can be nested
+        // in an `optional`, for example when `chain`ing a function returning
+        // a `runtime_optional`. The result is then the inner optional value.
+        template <typename T>
+        static constexpr auto apply(optional<runtime_optional<T>> const& opt)
+        { return opt.value_; }
+
+        template <typename T>
+        static constexpr auto apply(optional<runtime_optional<T>>&& opt)
+        { return static_cast<runtime_optional<T>&&>(opt.value_); }
+    };
+
+    template <>
+    struct monadic_fold_stop_impl<optional_tag> {
+        static constexpr hana::true_ apply(optional<> const&)
+        { return {}; }
+
+        template <typename Opt>
+        static constexpr hana::false_ apply(Opt const&)
+        { return {}; }
     };
 
     //////////////////////////////////////////////////////////////////////////
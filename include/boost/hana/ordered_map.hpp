@@ -0,0 +1,597 @@
+/*!
+@file
+Defines `boost::hana::ordered_map`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_ORDERED_MAP_HPP
+#define BOOST_HANA_ORDERED_MAP_HPP
+
+#include <boost/hana/fwd/ordered_map.hpp>
+
+#include <boost/hana/and.hpp>
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
+#include <boost/hana/concept/product.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/searchable.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/fwd/at_key.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace ordered_map_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Comparing keys
+        //
+        // Keys that are `IntegralConstant`s holding the same type are compared
+        // by their value, which avoids instantiating `hana::less` for each
+        // pair of keys. Other keys are compared with `hana::less`.
+        //////////////////////////////////////////////////////////////////////
+        template <typename Pair>
+        using key_type = typename detail::decay<
+            typename detail::map_key<Pair>::type
+        >::type;
+
+        template <typename K, bool = hana::IntegralConstant<K>::value>
+        struct integral_key {
+            using type = void;
+        };
+
+        template <typename K>
+        struct integral_key<K, true> {
+            using type = typename detail::decay<decltype(hana::value<K>())>::type;
+        };
+
+        template <typename K1, typename K2>
+        struct less_by_value {
+            static constexpr bool value = hana::value<K1>() < hana::value<K2>();
+        };
+
+        template <typename K1, typename K2>
+        struct less_by_hana {
+            using Result = decltype(hana::less(std::declval<K1 const&>(),
+                                               std::declval<K2 const&>()));
+            static_assert(hana::Constant<Result>::value,
+            "hana::ordered_map requires its keys to be Orderable at compile-time");
+
+            static constexpr bool value = hana::value<Result>();
+        };
+
+        template <typename K1, typename K2, typename T = typename integral_key<K1>::type>
+        struct key_less
+            : std::conditional_t<
+                !std::is_void<T>::value &&
+                    std::is_same<T, typename integral_key<K2>::type>::value,
+                less_by_value<K1, K2>,
+                less_by_hana<K1, K2>
+            >
+        { };
+
+        //////////////////////////////////////////////////////////////////////
+        // Sorting the entries
+        //
+        // The position of each entry in the sorted map is computed at once
+        // from a table of comparisons between all the keys, instead of
+        // moving entries around one at a time like `hana::sort` does. Only
+        // the first of several equal keys is kept.
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t n>
+        struct permutation {
+            detail::array<std::size_t, n> index;
+            std::size_t size;
+            bool unique;
+        };
+
+        // The result of comparing each pair of keys with `key_less`;
+        // `greater[i][j]` is whether the j-th key is less than the i-th key.
+        template <std::size_t n>
+        struct comparison_table {
+            detail::array<bool, n> greater[n + 1];
+
+            constexpr bool operator()(std::size_t i, std::size_t j) const
+            { return greater[j][i]; }
+        };
+
+        // The values of keys that are `IntegralConstant`s holding a `T`.
+        template <typename T, std::size_t n>
+        struct value_table {
+            T values[n + 1];
+
+            constexpr bool operator()(std::size_t i, std::size_t j) const
+            { return values[i] < values[j]; }
+        };
+
+        template <typename K, typename ...Keys>
+        constexpr detail::array<bool, sizeof...(Keys)> less_than()
+        { return {{key_less<Keys, K>::value...}}; }
+
+        template <typename ...Keys>
+        struct compare_keys {
+            static constexpr comparison_table<sizeof...(Keys)> table()
+            { return {{ordered_map_detail::less_than<Keys, Keys...>()..., {}}}; }
+        };
+
+        template <typename T, typename ...Keys>
+        struct compare_values {
+            static constexpr value_table<T, sizeof...(Keys)> table()
+            { return {{hana::value<Keys>()..., T{}}}; }
+        };
+
+        template <typename ...Keys>
+        struct comparisons : compare_keys<Keys...> { };
+
+        template <typename K, typename ...Keys>
+        struct comparisons<K, Keys...>
+            : std::conditional_t<
+                !std::is_void<typename integral_key<K>::type>::value &&
+                    detail::fast_and<std::is_same<
+                        typename integral_key<Keys>::type,
+                        typename integral_key<K>::type
+                    >::value...>::value,
+                compare_values<typename integral_key<K>::type, K, Keys...>,
+                compare_keys<K, Keys...>
+            >
+        { };
+
+        template <std::size_t n, typename Less>
+        constexpr permutation<n> sort_by(Less const& less) {
+            detail::array<bool, n> kept{};
+            permutation<n> result{};
+            result.unique = true;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                kept[i] = true;
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (kept[j] && !less(i, j) && !less(j, i)) {
+                        kept[i] = false;
+                        result.unique = false;
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!kept[i])
+                    continue;
+                std::size_t rank = 0;
+                for (std::size_t j = 0; j < n; ++j)
+                    rank += kept[j] && less(j, i);
+                result.index[rank] = i;
+                ++result.size;
+            }
+            return result;
+        }
+
+        template <typename ...Pairs>
+        struct order {
+            static constexpr permutation<sizeof...(Pairs)> value =
+                ordered_map_detail::sort_by<sizeof...(Pairs)>(
+                    comparisons<key_type<Pairs>...>::table());
+        };
+
+        template <typename ...Pairs>
+        constexpr permutation<sizeof...(Pairs)> order<Pairs...>::value;
+
+        //////////////////////////////////////////////////////////////////////
+        // Binary search over the keys of a sorted map
+        //////////////////////////////////////////////////////////////////////
+        template <typename Map>
+        struct layout;
+
+        template <typename ...Pairs>
+        struct layout<hana::ordered_map<Pairs...>> {
+            static constexpr std::size_t size = sizeof...(Pairs);
+
+            template <std::size_t i>
+            using entry = typename detail::type_at<i, Pairs...>::type;
+
+            template <std::size_t i>
+            using key = key_type<entry<i>>;
+        };
+
+        // `lower_bound` goes right while the middle key is less than `Key`,
+        // and `upper_bound` goes right while `Key` is not less than it.
+        template <bool Upper, typename Mid, typename Key>
+        struct goes_right : key_less<Mid, Key> { };
+
+        template <typename Mid, typename Key>
+        struct goes_right<true, Mid, Key> {
+            static constexpr bool value = !key_less<Key, Mid>::value;
+        };
+
+        template <typename Layout, typename Key, bool Upper,
+                  std::size_t lo, std::size_t hi, bool = (lo == hi)>
+        struct bound {
+            static constexpr std::size_t mid = lo + (hi - lo) / 2;
+            static constexpr std::size_t value = std::conditional_t<
+                goes_right<Upper, typename Layout::template key<mid>, Key>::value,
+                bound<Layout, Key, Upper, mid + 1, hi>,
+                bound<Layout, Key, Upper, lo, mid>
+            >::value;
+        };
+
+        template <typename Layout, typename Key, bool Upper,
+                  std::size_t lo, std::size_t hi>
+        struct bound<Layout, Key, Upper, lo, hi, true> {
+            static constexpr std::size_t value = lo;
+        };
+
+        template <typename Layout, typename Key, std::size_t i,
+                  bool = (i < Layout::size)>
+        struct is_key_at {
+            static constexpr bool value =
+                !key_less<Key, typename Layout::template key<i>>::value;
+        };
+
+        template <typename Layout, typename Key, std::size_t i>
+        struct is_key_at<Layout, Key, i, false> {
+            static constexpr bool value = false;
+        };
+
+        // The position of `Key` in `Map`, and whether `Key` is in `Map`.
+        template <typename Map, typename Key>
+        struct lookup {
+            using Layout = layout<Map>;
+            static constexpr std::size_t index =
+                bound<Layout, Key, false, 0, Layout::size>::value;
+            static constexpr bool found = is_key_at<Layout, Key, index>::value;
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Building ordered maps from entries that are already sorted
+        //////////////////////////////////////////////////////////////////////
+        struct sorted_t { };
+
+        template <typename ...Pairs, typename Storage, std::size_t ...p>
+        constexpr auto sort_entries(Storage&& storage, std::index_sequence<p...>) {
+            using Order = order<Pairs...>;
+            return hana::ordered_map<
+                typename detail::type_at<Order::value.index[p], Pairs...>::type...
+            >{sorted_t{},
+              hana::at_c<Order::value.index[p]>(static_cast<Storage&&>(storage))...};
+        }
+
+        template <typename ...Pairs>
+        constexpr auto from_storage(hana::basic_tuple<Pairs...>&& storage) {
+            return ordered_map_detail::sort_entries<Pairs...>(
+                static_cast<hana::basic_tuple<Pairs...>&&>(storage),
+                std::make_index_sequence<order<Pairs...>::value.size>{});
+        }
+
+        // Returns the entries `[from, from + n)` of a map.
+        template <std::size_t from, typename Map, std::size_t ...i>
+        constexpr auto entries(Map&& map, std::index_sequence<i...>) {
+            using Layout = layout<typename detail::decay<Map>::type>;
+            return hana::ordered_map<
+                typename Layout::template entry<from + i>...
+            >{sorted_t{}, hana::at_c<from + i>(static_cast<Map&&>(map).storage)...};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // ordered_map
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename ...Pairs>
+    struct ordered_map final
+        : detail::operators::adl<ordered_map<Pairs...>>
+        , detail::searchable_operators<ordered_map<Pairs...>>
+    {
+        using hana_tag = ordered_map_tag;
+        hana::basic_tuple<Pairs...> storage;
+
+        constexpr ordered_map() = default;
+
+        template <typename ...P>
+        explicit constexpr ordered_map(ordered_map_detail::sorted_t, P&& ...p)
+            : storage{static_cast<P&&>(p)...}
+        { }
+    };
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<ordered_map_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // make<ordered_map_tag>
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<ordered_map_tag> {
+        template <typename ...Pairs>
+        static constexpr auto apply(Pairs&& ...pairs) {
+#if defined(BOOST_HANA_CONFIG_ENABLE_DEBUG_MODE)
+            static_assert(detail::fast_and<hana::Product<Pairs>::value...>::value,
+            "hana::make_ordered_map(pairs...) requires all the 'pairs' to be Products");
+#endif
+
+            static_assert(ordered_map_detail::order<
+                typename detail::decay<Pairs>::type...
+            >::value.unique,
+            "hana::make_ordered_map({keys, values}...) requires all the keys to be unique");
+
+            return ordered_map_detail::from_storage(
+                hana::make_basic_tuple(static_cast<Pairs&&>(pairs)...));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Ordered queries
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename Map, typename Key>
+    constexpr auto lower_bound_t::operator()(Map const&, Key const&) const {
+        using Layout = ordered_map_detail::layout<Map>;
+        return hana::size_c<ordered_map_detail::bound<
+            Layout, Key, false, 0, Layout::size
+        >::value>;
+    }
+
+    template <typename Map, typename Key>
+    constexpr auto upper_bound_t::operator()(Map const&, Key const&) const {
+        using Layout = ordered_map_detail::layout<Map>;
+        return hana::size_c<ordered_map_detail::bound<
+            Layout, Key, true, 0, Layout::size
+        >::value>;
+    }
+
+    template <typename Map, typename From, typename To>
+    constexpr auto slice_keys_t::operator()(Map&& map, From const&, To const&) const {
+        using Layout = ordered_map_detail::layout<typename detail::decay<Map>::type>;
+        constexpr std::size_t first = ordered_map_detail::bound<
+            Layout, From, false, 0, Layout::size
+        >::value;
+        constexpr std::size_t last = ordered_map_detail::bound<
+            Layout, To, false, first, Layout::size
+        >::value;
+        return ordered_map_detail::entries<first>(static_cast<Map&&>(map),
+                                                  std::make_index_sequence<last - first>{});
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // keys
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct keys_impl<ordered_map_tag> {
+        template <typename Map>
+        static constexpr decltype(auto) apply(Map&& map) {
+            return hana::transform(static_cast<Map&&>(map).storage, hana::first);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // insert
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct insert_impl<ordered_map_tag> {
+        template <typename Map, typename Pair, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        insert_at(Map&& map, Pair&& pair, std::index_sequence<before...>,
+                                          std::index_sequence<after...>)
+        {
+            constexpr std::size_t i = sizeof...(before);
+            using Layout = ordered_map_detail::layout<typename detail::decay<Map>::type>;
+            return hana::ordered_map<
+                typename Layout::template entry<before>...,
+                typename detail::decay<Pair>::type,
+                typename Layout::template entry<i + after>...
+            >{ordered_map_detail::sorted_t{},
+              hana::at_c<before>(static_cast<Map&&>(map).storage)...,
+              static_cast<Pair&&>(pair),
+              hana::at_c<i + after>(static_cast<Map&&>(map).storage)...};
+        }
+
+        template <typename Map, typename Pair, typename Lookup>
+        static constexpr auto helper(Map&& map, Pair&&, Lookup, hana::true_)
+        { return static_cast<Map&&>(map); }
+
+        template <typename Map, typename Pair, typename Lookup>
+        static constexpr auto helper(Map&& map, Pair&& pair, Lookup, hana::false_) {
+            using Layout = ordered_map_detail::layout<typename detail::decay<Map>::type>;
+            return insert_at(static_cast<Map&&>(map), static_cast<Pair&&>(pair),
+                std::make_index_sequence<Lookup::index>{},
+                std::make_index_sequence<Layout::size - Lookup::index>{});
+        }
+
+        template <typename Map, typename Pair>
+        static constexpr auto apply(Map&& map, Pair&& pair) {
+            using Lookup = ordered_map_detail::lookup<
+                typename detail::decay<Map>::type,
+                ordered_map_detail::key_type<typename detail::decay<Pair>::type>
+            >;
+            return helper(static_cast<Map&&>(map), static_cast<Pair&&>(pair),
+                          Lookup{}, hana::bool_c<Lookup::found>);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // erase_key
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct erase_key_impl<ordered_map_tag> {
+        template <typename Map, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        erase_at(Map&& map, std::index_sequence<before...>, std::index_sequence<after...>) {
+            constexpr std::size_t i = sizeof...(before);
+            using Layout = ordered_map_detail::layout<typename detail::decay<Map>::type>;
+            return hana::ordered_map<
+                typename Layout::template entry<before>...,
+                typename Layout::template entry<i + 1 + after>...
+            >{ordered_map_detail::sorted_t{},
+              hana::at_c<before>(static_cast<Map&&>(map).storage)...,
+              hana::at_c<i + 1 + after>(static_cast<Map&&>(map).storage)...};
+        }
+
+        template <typename Map, typename Lookup>
+        static constexpr auto helper(Map&& map, Lookup, hana::false_)
+        { return static_cast<Map&&>(map); }
+
+        template <typename Map, typename Lookup>
+        static constexpr auto helper(Map&& map, Lookup, hana::true_) {
+            using Layout = ordered_map_detail::layout<typename detail::decay<Map>::type>;
+            return erase_at(static_cast<Map&&>(map),
+                std::make_index_sequence<Lookup::index>{},
+                std::make_index_sequence<Layout::size - Lookup::index - 1>{});
+        }
+
+        template <typename Map, typename Key>
+        static constexpr auto apply(Map&& map, Key const&) {
+            using Lookup = ordered_map_detail::lookup<typename detail::decay<Map>::type, Key>;
+            return helper(static_cast<Map&&>(map), Lookup{}, hana::bool_c<Lookup::found>);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<ordered_map_tag, ordered_map_tag> {
+        template <typename M1, typename M2, std::size_t ...i>
+        static constexpr auto helper(M1 const& m1, M2 const& m2, std::index_sequence<i...>) {
+            return hana::and_(hana::true_c, hana::equal(hana::at_c<i>(m1.storage),
+                                                        hana::at_c<i>(m2.storage))...);
+        }
+
+        template <typename M1, typename M2>
+        static constexpr auto compare(M1 const& m1, M2 const& m2, hana::true_)
+        { return helper(m1, m2, std::make_index_sequence<ordered_map_detail::layout<M1>::size>{}); }
+
+        template <typename M1, typename M2>
+        static constexpr auto compare(M1 const&, M2 const&, hana::false_)
+        { return hana::false_c; }
+
+        template <typename M1, typename M2>
+        static constexpr auto apply(M1 const& m1, M2 const& m2) {
+            return equal_impl::compare(m1, m2, hana::bool_c<
+                ordered_map_detail::layout<M1>::size == ordered_map_detail::layout<M2>::size
+            >);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_impl<ordered_map_tag> {
+        template <typename Map, typename Lookup>
+        static constexpr auto helper(Map&&, Lookup, hana::false_)
+        { return hana::nothing; }
+
+        template <typename Map, typename Lookup>
+        static constexpr auto helper(Map&& map, Lookup, hana::true_) {
+            return hana::just(hana::second(
+                hana::at_c<Lookup::index>(static_cast<Map&&>(map).storage)));
+        }
+
+        template <typename Map, typename Key>
+        static constexpr auto apply(Map&& map, Key const&) {
+            using Lookup = ordered_map_detail::lookup<typename detail::decay<Map>::type, Key>;
+            return helper(static_cast<Map&&>(map), Lookup{}, hana::bool_c<Lookup::found>);
+        }
+    };
+
+    template <>
+    struct find_if_impl<ordered_map_tag> {
+        template <typename M, typename Pred>
+        static constexpr auto apply(M&& map, Pred&& pred) {
+            return hana::transform(
+                hana::find_if(static_cast<M&&>(map).storage,
+                    hana::compose(static_cast<Pred&&>(pred), hana::first)),
+                hana::second
+            );
+        }
+    };
+
+    template <>
+    struct contains_impl<ordered_map_tag> {
+        template <typename Map, typename Key>
+        static constexpr auto apply(Map const&, Key const&) {
+            return hana::bool_c<ordered_map_detail::lookup<Map, Key>::found>;
+        }
+    };
+
+    template <>
+    struct any_of_impl<ordered_map_tag> {
+        template <typename M, typename Pred>
+        static constexpr auto apply(M const& map, Pred const& pred)
+        { return hana::any_of(hana::keys(map), pred); }
+    };
+
+    template <>
+    struct at_key_impl<ordered_map_tag> {
+        template <typename Map, typename Key>
+        static constexpr decltype(auto) apply(Map&& map, Key const&) {
+            using Lookup = ordered_map_detail::lookup<typename detail::decay<Map>::type, Key>;
+            static_assert(Lookup::found,
+            "hana::at_key(map, key) requires the 'key' to be present in the 'map'");
+            return hana::second(hana::at_c<Lookup::index>(static_cast<Map&&>(map).storage));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ordered_map_tag> {
+        template <typename M, typename F>
+        static constexpr decltype(auto) apply(M&& map, F&& f) {
+            return hana::unpack(static_cast<M&&>(map).storage,
+                                static_cast<F&&>(f));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Construction from a Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    struct to_impl<ordered_map_tag, F, when<hana::Foldable<F>::value>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            return ordered_map_detail::from_storage(
+                hana::unpack(static_cast<Xs&&>(xs), hana::make_basic_tuple));
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_ORDERED_MAP_HPP
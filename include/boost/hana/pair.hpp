@@ -72,9 +72,11 @@ BOOST_HANA_NAMESPACE_BEGIN
 
 
         // Possibly converting copy and move constructors
+        //
+        // Convertibility implies constructibility, so only convertibility is
+        // checked. This matters because these constraints are evaluated
+        // whenever a pair is copied or moved, e.g. for each entry of a map.
         template <typename T, typename U, typename = typename std::enable_if<
-            BOOST_HANA_TT_IS_CONSTRUCTIBLE(First, T const&) &&
-            BOOST_HANA_TT_IS_CONSTRUCTIBLE(Second, U const&) &&
             BOOST_HANA_TT_IS_CONVERTIBLE(T const&, First) &&
             BOOST_HANA_TT_IS_CONVERTIBLE(U const&, Second)
         >::type>
@@ -84,8 +86,6 @@ BOOST_HANA_NAMESPACE_BEGIN
         { }
 
         template <typename T, typename U, typename = typename std::enable_if<
-            BOOST_HANA_TT_IS_CONSTRUCTIBLE(First, T&&) &&
-            BOOST_HANA_TT_IS_CONSTRUCTIBLE(Second, U&&) &&
             BOOST_HANA_TT_IS_CONVERTIBLE(T&&, First) &&
             BOOST_HANA_TT_IS_CONVERTIBLE(U&&, Second)
         >::type>
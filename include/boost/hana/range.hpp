@@ -13,17 +13,21 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/range.hpp>
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/comparable.hpp>
 #include <boost/hana/concept/integral_constant.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/common.hpp>
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/has_common_embedding.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/iterable.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/back.hpp>
 #include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/count.hpp>
+#include <boost/hana/fwd/count_if.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/drop_front_exactly.hpp>
 #include <boost/hana/fwd/equal.hpp>
@@ -41,6 +45,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/value.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -208,6 +213,40 @@ BOOST_HANA_NAMESPACE_BEGIN
         { return integral_c<T, product_helper(from, to)>; }
     };
 
+    template <>
+    struct count_impl<range_tag> {
+        // The value can only be compared without `hana::equal` when it is an
+        // IntegralConstant whose type shares a safe embedding with `T`, which
+        // rules out mixing signed and unsigned types. Any other case goes
+        // through `hana::equal`, which rejects such comparisons.
+        template <typename T, typename N, bool = hana::IntegralConstant<N>::value>
+        struct is_comparable_constant
+            : detail::has_common_embedding<Comparable, T, typename N::value_type>
+        { };
+
+        template <typename T, typename N>
+        struct is_comparable_constant<T, N, false> : std::false_type { };
+
+        template <typename T, T from, T to, typename N>
+        static constexpr auto count_helper(range<T, from, to> const&, N const&, hana::true_) {
+            using C = typename std::common_type<T, typename N::value_type>::type;
+            constexpr C n = N::value;
+            return hana::size_c<(n >= C{from} && n < C{to}) ? 1 : 0>;
+        }
+
+        template <typename T, T from, T to, typename N>
+        static constexpr auto count_helper(range<T, from, to> const& r, N const& n, hana::false_) {
+            return hana::count_if(r, hana::equal.to(n));
+        }
+
+        template <typename T, T from, T to, typename N>
+        static constexpr auto apply(range<T, from, to> const& r, N const& n) {
+            return count_helper(r, n, hana::bool_c<
+                is_comparable_constant<T, N>::value
+            >);
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,441 @@
+/*!
+@file
+Defines `boost::hana::runtime_optional`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_RUNTIME_OPTIONAL_HPP
+#define BOOST_HANA_RUNTIME_OPTIONAL_HPP
+
+#include <boost/hana/fwd/runtime_optional.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/monad.hpp>
+#include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/ap.hpp>
+#include <boost/hana/fwd/chain.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/find_if.hpp>
+#include <boost/hana/fwd/flatten.hpp>
+#include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/lift.hpp>
+#include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/value.hpp>
+
+#include <memory> // std::addressof
+#include <new>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //////////////////////////////////////////////////////////////////////////
+    // runtime_optional
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    namespace detail {
+        struct runtime_optional_in_place { };
+
+        // Storage for a `runtime_optional<T>`. When `T` is trivially copyable,
+        // so is the storage, which keeps `runtime_optional` usable in constant
+        // expressions and as cheap to pass around as a `T` and a `bool`.
+        template <typename T, bool = std::is_trivially_copyable<T>::value>
+        struct runtime_optional_storage {
+            struct empty { };
+            union { empty empty_; T value_; };
+            bool engaged_;
+
+            constexpr runtime_optional_storage()
+                : empty_(), engaged_(false)
+            { }
+
+            template <typename ...Args>
+            constexpr explicit
+            runtime_optional_storage(runtime_optional_in_place, Args&& ...args)
+                : value_(static_cast<Args&&>(args)...), engaged_(true)
+            { }
+        };
+
+        template <typename T>
+        struct runtime_optional_storage<T, false> {
+            struct empty { };
+            union { empty empty_; T value_; };
+            bool engaged_;
+
+            constexpr runtime_optional_storage()
+                : empty_(), engaged_(false)
+            { }
+
+            template <typename ...Args>
+            constexpr explicit
+            runtime_optional_storage(runtime_optional_in_place, Args&& ...args)
+                : value_(static_cast<Args&&>(args)...), engaged_(true)
+            { }
+
+            runtime_optional_storage(runtime_optional_storage const& other)
+                : empty_(), engaged_(other.engaged_)
+            {
+                if (engaged_)
+                    ::new (static_cast<void*>(std::addressof(value_))) T(other.value_);
+            }
+
+            runtime_optional_storage(runtime_optional_storage&& other)
+                : empty_(), engaged_(other.engaged_)
+            {
+                if (engaged_)
+                    ::new (static_cast<void*>(std::addressof(value_)))
+                        T(static_cast<T&&>(other.value_));
+            }
+
+            runtime_optional_storage& operator=(runtime_optional_storage const& other) {
+                if (engaged_ && other.engaged_)
+                    value_ = other.value_;
+                else if (other.engaged_)
+                    this->construct(other.value_);
+                else
+                    this->reset();
+                return *this;
+            }
+
+            runtime_optional_storage& operator=(runtime_optional_storage&& other) {
+                if (engaged_ && other.engaged_)
+                    value_ = static_cast<T&&>(other.value_);
+                else if (other.engaged_)
+                    this->construct(static_cast<T&&>(other.value_));
+                else
+                    this->reset();
+                return *this;
+            }
+
+            ~runtime_optional_storage()
+            { this->reset(); }
+
+        private:
+            template <typename U>
+            void construct(U&& u) {
+                ::new (static_cast<void*>(std::addressof(value_))) T(static_cast<U&&>(u));
+                engaged_ = true;
+            }
+
+            void reset() {
+                if (engaged_) {
+                    value_.~T();
+                    engaged_ = false;
+                }
+            }
+        };
+    }
+
+    template <typename T>
+    struct runtime_optional
+        : detail::operators::adl<>
+        , detail::runtime_optional_storage<T>
+    {
+        using storage_type = detail::runtime_optional_storage<T>;
+
+        // Constructors
+        constexpr runtime_optional() = default;
+        constexpr runtime_optional(runtime_optional const&) = default;
+        constexpr runtime_optional(runtime_optional&&) = default;
+
+        constexpr runtime_optional(T const& t)
+            : storage_type(detail::runtime_optional_in_place{}, t)
+        { }
+
+        constexpr runtime_optional(T&& t)
+            : storage_type(detail::runtime_optional_in_place{}, static_cast<T&&>(t))
+        { }
+
+        template <typename U>
+        constexpr runtime_optional(hana::optional<U> const& opt)
+            : storage_type(detail::runtime_optional_in_place{}, opt.value_)
+        { }
+
+        template <typename U>
+        constexpr runtime_optional(hana::optional<U>&& opt)
+            : storage_type(detail::runtime_optional_in_place{},
+                           static_cast<U&&>(opt.value_))
+        { }
+
+        template <typename ...Nothing, typename = typename std::enable_if<
+            sizeof...(Nothing) == 0
+        >::type>
+        constexpr runtime_optional(hana::optional<Nothing...> const&)
+            : storage_type()
+        { }
+
+        // Assignment
+        constexpr runtime_optional& operator=(runtime_optional const&) = default;
+        constexpr runtime_optional& operator=(runtime_optional&&) = default;
+
+        // Observers
+        constexpr bool has_value() const { return this->engaged_; }
+        constexpr explicit operator bool() const { return this->engaged_; }
+
+        constexpr T const* operator->() const { return std::addressof(this->value_); }
+        constexpr T* operator->() { return std::addressof(this->value_); }
+
+        constexpr T&        value() & { return this->value_; }
+        constexpr T const&  value() const& { return this->value_; }
+        constexpr T&&       value() && { return static_cast<T&&>(this->value_); }
+        constexpr T const&& value() const&& { return static_cast<T const&&>(this->value_); }
+
+        constexpr T&        operator*() & { return this->value_; }
+        constexpr T const&  operator*() const& { return this->value_; }
+        constexpr T&&       operator*() && { return static_cast<T&&>(this->value_); }
+        constexpr T const&& operator*() const&& { return static_cast<T const&&>(this->value_); }
+
+        template <typename U>
+        constexpr T value_or(U&& u) const& {
+            return this->engaged_ ? this->value_
+                                  : static_cast<T>(static_cast<U&&>(u));
+        }
+
+        template <typename U>
+        constexpr T value_or(U&& u) && {
+            return this->engaged_ ? static_cast<T&&>(this->value_)
+                                  : static_cast<T>(static_cast<U&&>(u));
+        }
+    };
+    //! @endcond
+
+    template <typename T>
+    struct tag_of<runtime_optional<T>> {
+        using type = runtime_optional_tag;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // make<runtime_optional_tag>
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<runtime_optional_tag> {
+        template <typename X>
+        static constexpr auto apply(X&& x) {
+            return hana::runtime_optional<typename detail::decay<X>::type>(
+                static_cast<X&&>(x)
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<runtime_optional_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct orderable_operators<runtime_optional_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct monad_operators<runtime_optional_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<runtime_optional_tag, runtime_optional_tag> {
+        template <typename T, typename U>
+        static constexpr bool
+        apply(runtime_optional<T> const& x, runtime_optional<U> const& y) {
+            return x.engaged_ && y.engaged_
+                ? static_cast<bool>(hana::equal(x.value_, y.value_))
+                : x.engaged_ == y.engaged_;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<runtime_optional_tag, runtime_optional_tag> {
+        template <typename T, typename U>
+        static constexpr bool
+        apply(runtime_optional<T> const& x, runtime_optional<U> const& y) {
+            return y.engaged_ &&
+                (!x.engaged_ || static_cast<bool>(hana::less(x.value_, y.value_)));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<runtime_optional_tag> {
+        template <typename Opt, typename F>
+        static constexpr auto apply(Opt&& opt, F&& f) {
+            using Result = hana::runtime_optional<typename detail::decay<
+                decltype(static_cast<F&&>(f)(*static_cast<Opt&&>(opt)))
+            >::type>;
+            return opt.engaged_ ? Result(static_cast<F&&>(f)(*static_cast<Opt&&>(opt)))
+                                : Result();
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Applicative
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct lift_impl<runtime_optional_tag> {
+        template <typename X>
+        static constexpr auto apply(X&& x)
+        { return hana::make_runtime_optional(static_cast<X&&>(x)); }
+    };
+
+    template <>
+    struct ap_impl<runtime_optional_tag> {
+        template <typename F, typename X>
+        static constexpr auto apply(F&& f, X&& x) {
+            using Result = hana::runtime_optional<typename detail::decay<
+                decltype((*static_cast<F&&>(f))(*static_cast<X&&>(x)))
+            >::type>;
+            return f.engaged_ && x.engaged_
+                ? Result((*static_cast<F&&>(f))(*static_cast<X&&>(x)))
+                : Result();
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monad
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Feeds the value of a `runtime_optional` (if any) to a function
+        // returning the optional value `Inner`, and flattens the result.
+        // When `Inner` is a `hana::optional`, its state is known statically,
+        // and the result is a `runtime_optional` or `hana::nothing`.
+        template <typename Inner>
+        struct runtime_optional_join;
+
+        template <typename T>
+        struct runtime_optional_join<hana::runtime_optional<T>> {
+            template <typename Opt, typename F>
+            static constexpr hana::runtime_optional<T> apply(Opt&& opt, F&& f) {
+                return opt.engaged_ ? static_cast<F&&>(f)(*static_cast<Opt&&>(opt))
+                                    : hana::runtime_optional<T>();
+            }
+        };
+
+        template <typename T>
+        struct runtime_optional_join<hana::optional<T>> {
+            template <typename Opt, typename F>
+            static constexpr hana::runtime_optional<T> apply(Opt&& opt, F&& f) {
+                return opt.engaged_
+                    ? hana::runtime_optional<T>(static_cast<F&&>(f)(*static_cast<Opt&&>(opt)))
+                    : hana::runtime_optional<T>();
+            }
+        };
+
+        template <>
+        struct runtime_optional_join<hana::optional<>> {
+            template <typename Opt, typename F>
+            static constexpr auto apply(Opt&& opt, F&& f) {
+                if (opt.engaged_)
+                    static_cast<F&&>(f)(*static_cast<Opt&&>(opt));
+                return hana::nothing;
+            }
+        };
+    }
+
+    template <>
+    struct flatten_impl<runtime_optional_tag> {
+        template <typename Opt>
+        static constexpr auto apply(Opt&& opt) {
+            using Inner = typename detail::decay<decltype(*static_cast<Opt&&>(opt))>::type;
+            return detail::runtime_optional_join<Inner>::apply(
+                static_cast<Opt&&>(opt), hana::id
+            );
+        }
+    };
+
+    template <>
+    struct chain_impl<runtime_optional_tag> {
+        template <typename Opt, typename F>
+        static constexpr auto apply(Opt&& opt, F&& f) {
+            using Inner = typename detail::decay<
+                decltype(static_cast<F&&>(f)(*static_cast<Opt&&>(opt)))
+            >::type;
+            return detail::runtime_optional_join<Inner>::apply(
+                static_cast<Opt&&>(opt), static_cast<F&&>(f)
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Whether the result of a predicate is known to be false at
+        // compile-time, in which case no runtime check is required.
+        template <typename Result, bool = hana::Constant<Result>::value>
+        struct runtime_optional_never {
+            static constexpr bool value = false;
+        };
+
+        template <typename Result>
+        struct runtime_optional_never<Result, true> {
+            static constexpr bool value = !static_cast<bool>(hana::value<Result>());
+        };
+    }
+
+    template <>
+    struct find_if_impl<runtime_optional_tag> {
+        template <typename Opt, typename Pred>
+        static constexpr auto find_if_helper(Opt&&, Pred&&, hana::true_)
+        { return hana::nothing; }
+
+        template <typename Opt, typename Pred>
+        static constexpr auto find_if_helper(Opt&& opt, Pred&& pred, hana::false_) {
+            using Result = typename detail::decay<Opt>::type;
+            return opt.engaged_ && static_cast<bool>(static_cast<Pred&&>(pred)(*opt))
+                ? Result(*static_cast<Opt&&>(opt))
+                : Result();
+        }
+
+        template <typename Opt, typename Pred>
+        static constexpr auto apply(Opt&& opt, Pred&& pred) {
+            using Never = detail::runtime_optional_never<
+                typename detail::decay<decltype(static_cast<Pred&&>(pred)(*opt))>::type
+            >;
+            return find_if_helper(static_cast<Opt&&>(opt), static_cast<Pred&&>(pred),
+                                  hana::bool_c<Never::value>);
+        }
+    };
+
+    template <>
+    struct any_of_impl<runtime_optional_tag> {
+        template <typename Opt, typename Pred>
+        static constexpr auto any_of_helper(Opt const&, Pred&&, hana::true_)
+        { return hana::false_c; }
+
+        template <typename Opt, typename Pred>
+        static constexpr bool any_of_helper(Opt const& opt, Pred&& pred, hana::false_)
+        { return opt.engaged_ && static_cast<bool>(static_cast<Pred&&>(pred)(*opt)); }
+
+        template <typename Opt, typename Pred>
+        static constexpr auto apply(Opt const& opt, Pred&& pred) {
+            using Never = detail::runtime_optional_never<
+                typename detail::decay<decltype(static_cast<Pred&&>(pred)(*opt))>::type
+            >;
+            return any_of_helper(opt, static_cast<Pred&&>(pred),
+                                 hana::bool_c<Never::value>);
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_RUNTIME_OPTIONAL_HPP
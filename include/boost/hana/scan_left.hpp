@@ -12,14 +12,17 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/scan_left.hpp>
 
-#include <boost/hana/at.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
-#include <boost/hana/empty.hpp>
-#include <boost/hana/length.hpp>
-#include <boost/hana/prepend.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
+#include <boost/hana/fwd/plus.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple_builder.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -59,73 +62,152 @@ BOOST_HANA_NAMESPACE_BEGIN
     }
     //! @endcond
 
+    namespace detail {
+        // Extends a builder with `f(last, x)`, where `last` is the last
+        // element of the builder. The new link owns that element, so it is
+        // only moved once, into the result.
+        template <typename F>
+        struct scan_left_step {
+            F const& f;
+
+            template <typename Builder, typename X>
+            constexpr auto operator()(Builder&& builder, X&& x) const {
+                using Element = typename detail::decay<
+                    decltype(f(builder.last_, static_cast<X&&>(x)))
+                >::type;
+                return detail::builder_link<Builder, Element>{
+                    static_cast<Builder&&>(builder),
+                    f(builder.last_, static_cast<X&&>(x))
+                };
+            }
+        };
+
+        template <typename F, typename K>
+        struct scan_left_from_first {
+            F const& f;
+            K const& k;
+
+            constexpr auto operator()() const
+            { return k(hana::make_tuple_builder()); }
+
+            template <typename X1, typename ...Xn>
+            constexpr auto operator()(X1&& x1, Xn&& ...xn) const {
+                using Step = scan_left_step<F>;
+                return detail::fold_builder<Step, K>{Step{f}, k}(
+                    hana::push_back(hana::make_tuple_builder(), static_cast<X1&&>(x1)),
+                    static_cast<Xn&&>(xn)...
+                );
+            }
+        };
+
+        template <typename F, typename K, typename State>
+        struct scan_left_from_state {
+            F const& f;
+            K const& k;
+            State&& state;
+
+            template <typename ...Xn>
+            constexpr auto operator()(Xn&& ...xn) const {
+                using Step = scan_left_step<F>;
+                return detail::fold_builder<Step, K>{Step{f}, k}(
+                    hana::push_back(hana::make_tuple_builder(),
+                                    static_cast<State&&>(state)),
+                    static_cast<Xn&&>(xn)...
+                );
+            }
+        };
+
+        template <typename V, V ...v>
+        constexpr detail::array<V, sizeof...(v)> prefix_sums() {
+            detail::array<V, sizeof...(v)> sums{{v...}};
+            for (std::size_t i = 1; i < sizeof...(v); ++i)
+                sums[i] = sums[i - 1] + sums[i];
+            return sums;
+        }
+
+        // The values whose prefix sums are `scan_left(xs, [state,] f)`, when
+        // `f` is `hana::plus` and `xs` holds `integral_constant`s of the same
+        // type as `state`. Otherwise, `not_integral_elements`.
+        template <typename F, typename Elements, typename ...State>
+        struct integral_scan {
+            using type = not_integral_elements;
+        };
+
+        template <typename V, V ...v>
+        struct integral_scan<plus_t, std::integer_sequence<V, v...>> {
+            using type = std::integer_sequence<V, v...>;
+        };
+
+        template <typename V, V ...v, V s>
+        struct integral_scan<plus_t, std::integer_sequence<V, v...>,
+                             hana::integral_constant<V, s>>
+        {
+            using type = std::integer_sequence<V, s, v...>;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // The states are accumulated in a `tuple_builder`, whose last element is
+    // the current state, and the builder is folded over the elements with
+    // `detail::fold_builder`. Each link owns the state it appends, and the
+    // result is created in a single pass at the end, instead of prepending
+    // to a new sequence at each step. The depth of the recursion is that of
+    // `fold_left`.
+    //
+    // When `f` is `hana::plus` and the elements (and state) are integral
+    // constants of a single type, the result is computed with a constexpr
+    // loop over their values instead.
+    //////////////////////////////////////////////////////////////////////////
     template <typename S, bool condition>
     struct scan_left_impl<S, when<condition>> : default_ {
-        // Without initial state
-        template <typename Xs, typename F, std::size_t n1, std::size_t n2, std::size_t ...ns>
+        template <typename V, V ...v, std::size_t ...i>
         static constexpr auto
-        apply1_impl(Xs&& xs, F const& f, std::index_sequence<n1, n2, ns...>) {
-            static_assert(n1 == 0, "logic error in Boost.Hana: file a bug report");
-
-            // Use scan_left with the first element as an initial state.
-            return scan_left_impl::apply_impl(
-                static_cast<Xs&&>(xs),
-                hana::at_c<0>(static_cast<Xs&&>(xs)),
-                f, std::index_sequence<n2, ns...>{}
-            );
-        }
-
-        template <typename Xs, typename F, std::size_t n>
-        static constexpr auto apply1_impl(Xs&& xs, F const&, std::index_sequence<n>) {
-            return hana::make<S>(hana::at_c<n>(static_cast<Xs&&>(xs)));
-        }
+        make_prefix_sums(std::integer_sequence<V, v...>, std::index_sequence<i...>)
+        { return hana::make<S>(hana::integral_c<V, detail::prefix_sums<V, v...>()[i]>...); }
 
-        template <typename Xs, typename F>
-        static constexpr auto apply1_impl(Xs&&, F const&, std::index_sequence<>) {
-            return hana::empty<S>();
+        template <typename Xs, typename ...State, typename F, typename V, V ...v>
+        static constexpr auto
+        apply_impl(Xs&&, F const&, std::integer_sequence<V, v...> values, State&&...) {
+            return scan_left_impl::make_prefix_sums(values,
+                                        std::make_index_sequence<sizeof...(v)>{});
         }
 
         template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F const& f) {
-            constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_left_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                               f, std::make_index_sequence<Len>{});
-        }
-
-
-        // With initial state
-        template <typename Xs, typename State, typename F,
-                  std::size_t n1, std::size_t n2, std::size_t ...ns>
         static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f,
-                   std::index_sequence<n1, n2, ns...>)
-        {
-            auto rest = scan_left_impl::apply_impl(
-                                static_cast<Xs&&>(xs),
-                                f(state, hana::at_c<n1>(static_cast<Xs&&>(xs))),
-                                f, std::index_sequence<n2, ns...>{});
-            return hana::prepend(std::move(rest), static_cast<State&&>(state));
+        apply_impl(Xs&& xs, F const& f, detail::not_integral_elements) {
+            using K = detail::make_from_builder<S>;
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                detail::scan_left_from_first<F, K>{f, K{}});
         }
 
-        template <typename Xs, typename State, typename F, std::size_t n>
+        template <typename Xs, typename F, typename State>
         static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f, std::index_sequence<n>) {
-            auto new_state = f(state, hana::at_c<n>(static_cast<Xs&&>(xs)));
-            return hana::make<S>(static_cast<State&&>(state), std::move(new_state));
+        apply_impl(Xs&& xs, F const& f, detail::not_integral_elements, State&& state) {
+            using K = detail::make_from_builder<S>;
+            return hana::unpack(static_cast<Xs&&>(xs),
+                detail::scan_left_from_state<F, K, State>{
+                    f, K{}, static_cast<State&&>(state)
+                });
         }
 
-        template <typename Xs, typename State, typename F>
-        static constexpr auto
-        apply_impl(Xs&&, State&& state, F const&, std::index_sequence<>) {
-            return hana::make<S>(static_cast<State&&>(state));
+        // Without initial state
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F const& f) {
+            using Values = typename detail::integral_scan<F,
+                typename detail::integral_elements<typename detail::decay<Xs>::type>::type
+            >::type;
+            return scan_left_impl::apply_impl(static_cast<Xs&&>(xs), f, Values{});
         }
 
+        // With initial state
         template <typename Xs, typename State, typename F>
         static constexpr auto apply(Xs&& xs, State&& state, F const& f) {
-            constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_left_impl::apply_impl(static_cast<Xs&&>(xs),
-                                              static_cast<State&&>(state),
-                                              f, std::make_index_sequence<Len>{});
+            using Values = typename detail::integral_scan<F,
+                typename detail::integral_elements<typename detail::decay<Xs>::type>::type,
+                typename detail::decay<State>::type
+            >::type;
+            return scan_left_impl::apply_impl(static_cast<Xs&&>(xs), f, Values{},
+                                              static_cast<State&&>(state));
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -17,10 +17,14 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
 #include <boost/hana/empty.hpp>
-#include <boost/hana/front.hpp>
+#include <boost/hana/fwd/plus.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
-#include <boost/hana/prepend.hpp>
+#include <boost/hana/tuple_builder.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -60,69 +64,143 @@ BOOST_HANA_NAMESPACE_BEGIN
     }
     //! @endcond
 
+    namespace detail {
+        // Extends a builder with `f(x, last)`, where `last` is the last
+        // element of the builder. Like for `scan_left`, the new link owns
+        // that element.
+        template <typename F>
+        struct scan_right_step {
+            F const& f;
+
+            template <typename Builder, typename X>
+            constexpr auto operator()(Builder&& builder, X&& x) const {
+                using Element = typename detail::decay<
+                    decltype(f(static_cast<X&&>(x), builder.last_))
+                >::type;
+                return detail::builder_link<Builder, Element>{
+                    static_cast<Builder&&>(builder),
+                    f(static_cast<X&&>(x), builder.last_)
+                };
+            }
+        };
+
+        template <typename V, V ...v>
+        constexpr detail::array<V, sizeof...(v)> suffix_sums() {
+            detail::array<V, sizeof...(v)> sums{{v...}};
+            for (std::size_t i = sizeof...(v) - 1; i > 0; --i)
+                sums[i - 1] = sums[i - 1] + sums[i];
+            return sums;
+        }
+
+        // The values whose suffix sums are `scan_right(xs, [state,] f)`, when
+        // `f` is `hana::plus` and `xs` holds `integral_constant`s of the same
+        // type as `state`. Otherwise, `not_integral_elements`.
+        template <typename F, typename Elements, typename ...State>
+        struct integral_scan_right {
+            using type = not_integral_elements;
+        };
+
+        template <typename V, V ...v>
+        struct integral_scan_right<plus_t, std::integer_sequence<V, v...>> {
+            using type = std::integer_sequence<V, v...>;
+        };
+
+        template <typename V, V ...v, V s>
+        struct integral_scan_right<plus_t, std::integer_sequence<V, v...>,
+                                   hana::integral_constant<V, s>>
+        {
+            using type = std::integer_sequence<V, v..., s>;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Like for `scan_left`, the states are accumulated in a `tuple_builder`
+    // that is folded over the elements, taken from the last one to the first
+    // one. Hence, the builder holds the states from the last one to the
+    // first one, and the result is created in a single pass by reading the
+    // builder backwards.
+    //////////////////////////////////////////////////////////////////////////
     template <typename S, bool condition>
     struct scan_right_impl<S, when<condition>> : default_ {
-        // Without initial state
-        template <typename Xs, typename F, std::size_t n1, std::size_t n2, std::size_t ...ns>
+        template <typename V, V ...v, std::size_t ...i>
         static constexpr auto
-        apply1_impl(Xs&& xs, F const& f, std::index_sequence<n1, n2, ns...>) {
-            auto rest = scan_right_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                                     f, std::index_sequence<n2, ns...>{});
-            auto element = f(hana::at_c<n1>(static_cast<Xs&&>(xs)), hana::front(rest));
-            return hana::prepend(std::move(rest), std::move(element));
+        make_suffix_sums(std::integer_sequence<V, v...>, std::index_sequence<i...>)
+        { return hana::make<S>(hana::integral_c<V, detail::suffix_sums<V, v...>()[i]>...); }
+
+        template <typename Xs, typename ...State, typename F, typename V, V ...v>
+        static constexpr auto
+        apply_impl(Xs&&, F const&, std::integer_sequence<V, v...> values, State&&...) {
+            return scan_right_impl::make_suffix_sums(values,
+                                        std::make_index_sequence<sizeof...(v)>{});
         }
 
-        template <typename Xs, typename F, std::size_t n>
-        static constexpr auto apply1_impl(Xs&& xs, F const&, std::index_sequence<n>) {
-            return hana::make<S>(hana::at_c<n>(static_cast<Xs&&>(xs)));
+        // Without initial state
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr auto
+        apply1_impl(Xs&& xs, F const& f, std::index_sequence<0, i...>) {
+            // The last element is the initial state, and it is folded with
+            // the other elements, from the one before it to the first one.
+            constexpr std::size_t n = sizeof...(i);
+            using Step = detail::scan_right_step<F>;
+            using K = detail::make_from_builder<S, true>;
+            return detail::fold_builder<Step, K>{Step{f}, K{}}(
+                hana::push_back(hana::make_tuple_builder(),
+                                hana::at_c<n>(static_cast<Xs&&>(xs))),
+                hana::at_c<n - i>(static_cast<Xs&&>(xs))...
+            );
         }
 
         template <typename Xs, typename F>
-        static constexpr auto apply1_impl(Xs&&, F const&, std::index_sequence<>) {
-            return hana::empty<S>();
-        }
+        static constexpr auto apply1_impl(Xs&&, F const&, std::index_sequence<>)
+        { return hana::empty<S>(); }
 
         template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F const& f) {
+        static constexpr auto
+        apply_impl(Xs&& xs, F const& f, detail::not_integral_elements) {
             constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_right_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                                f, std::make_index_sequence<Len>{});
+            return scan_right_impl::apply1_impl(static_cast<Xs&&>(xs), f,
+                                                std::make_index_sequence<Len>{});
         }
 
-
-        // With initial state
-        template <typename Xs, typename State, typename F,
-                  std::size_t n1, std::size_t n2, std::size_t ...ns>
-        static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f,
-                   std::index_sequence<n1, n2, ns...>)
-        {
-            auto rest = scan_right_impl::apply_impl(static_cast<Xs&&>(xs),
-                                                    static_cast<State&&>(state),
-                                                    f, std::index_sequence<n2, ns...>{});
-            auto element = f(hana::at_c<n1>(static_cast<Xs&&>(xs)), hana::front(rest));
-            return hana::prepend(std::move(rest), std::move(element));
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F const& f) {
+            using Values = typename detail::integral_scan_right<F,
+                typename detail::integral_elements<typename detail::decay<Xs>::type>::type
+            >::type;
+            return scan_right_impl::apply_impl(static_cast<Xs&&>(xs), f, Values{});
         }
 
-        template <typename Xs, typename State, typename F, std::size_t n>
+        // With initial state
+        template <typename Xs, typename F, typename State, std::size_t ...i>
         static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f, std::index_sequence<n>) {
-            auto element = f(hana::at_c<n>(static_cast<Xs&&>(xs)), state);
-            return hana::make<S>(std::move(element), static_cast<State&&>(state));
+        apply_state_impl(Xs&& xs, F const& f, State&& state, std::index_sequence<i...>) {
+            constexpr std::size_t n = sizeof...(i);
+            using Step = detail::scan_right_step<F>;
+            using K = detail::make_from_builder<S, true>;
+            return detail::fold_builder<Step, K>{Step{f}, K{}}(
+                hana::push_back(hana::make_tuple_builder(),
+                                static_cast<State&&>(state)),
+                hana::at_c<n - 1 - i>(static_cast<Xs&&>(xs))...
+            );
         }
 
-        template <typename Xs, typename State, typename F>
+        template <typename Xs, typename F, typename State>
         static constexpr auto
-        apply_impl(Xs&&, State&& state, F const&, std::index_sequence<>) {
-            return hana::make<S>(static_cast<State&&>(state));
+        apply_impl(Xs&& xs, F const& f, detail::not_integral_elements, State&& state) {
+            constexpr std::size_t Len = decltype(hana::length(xs))::value;
+            return scan_right_impl::apply_state_impl(static_cast<Xs&&>(xs), f,
+                                                     static_cast<State&&>(state),
+                                                     std::make_index_sequence<Len>{});
         }
 
         template <typename Xs, typename State, typename F>
         static constexpr auto apply(Xs&& xs, State&& state, F const& f) {
-            constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_right_impl::apply_impl(static_cast<Xs&&>(xs),
-                                               static_cast<State&&>(state),
-                                               f, std::make_index_sequence<Len>{});
+            using Values = typename detail::integral_scan_right<F,
+                typename detail::integral_elements<typename detail::decay<Xs>::type>::type,
+                typename detail::decay<State>::type
+            >::type;
+            return scan_right_impl::apply_impl(static_cast<Xs&&>(xs), f, Values{},
+                                               static_cast<State&&>(state));
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -205,14 +205,38 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        struct set_has_duplicates {
+            template <typename ...Xs>
+            constexpr hana::bool_<detail::has_duplicates<Xs&&...>::value>
+            operator()(Xs&& ...) const { return {}; }
+        };
+    }
+
     template <typename F>
     struct to_impl<set_tag, F, when<hana::Foldable<F>::value>> {
+        // When there are no duplicates, which is checked in linear time,
+        // the set is created directly instead of inserting the elements
+        // one by one.
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs) {
+        static constexpr decltype(auto) apply_impl(Xs&& xs, hana::false_) {
+            return hana::unpack(static_cast<Xs&&>(xs), hana::make_set);
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply_impl(Xs&& xs, hana::true_) {
             return hana::fold_left(static_cast<Xs&&>(xs),
                                    hana::make_set(),
                                    hana::insert);
         }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using HasDuplicates = decltype(
+                hana::unpack(xs, detail::set_has_duplicates{})
+            );
+            return apply_impl(static_cast<Xs&&>(xs), HasDuplicates{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
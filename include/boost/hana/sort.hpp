@@ -17,11 +17,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/less.hpp>
 
-#include <utility> // std::declval, std::index_sequence
+#include <cstddef>
+#include <utility> // std::declval, std::index_sequence, std::integer_sequence
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -144,6 +149,17 @@ BOOST_HANA_NAMESPACE_BEGIN
                 Pred, std::index_sequence<>, i...
             >::type;
         };
+
+        // The values are sorted once, when the data member is initialized,
+        // instead of once per element of the result.
+        template <typename V, V ...v>
+        struct sorted_values {
+            static constexpr detail::array<V, sizeof...(v)> value =
+                detail::array<V, sizeof...(v)>{{v...}}.sort();
+        };
+
+        template <typename V, V ...v>
+        constexpr detail::array<V, sizeof...(v)> sorted_values<V, v...>::value;
     } // end namespace detail
 
     template <typename S, bool condition>
@@ -165,8 +181,32 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
 
         template <typename Xs>
-        static constexpr auto apply(Xs&& xs)
+        static constexpr auto
+        apply_default(Xs&& xs, detail::not_integral_elements)
         { return sort_impl::apply(static_cast<Xs&&>(xs), hana::less); }
+
+        // When all the elements are `integral_constant`s of the same type,
+        // their values are sorted with a `constexpr` loop, and the result
+        // is made of new `integral_constant`s holding the sorted values.
+        template <typename V, V ...v, std::size_t ...i>
+        static constexpr auto
+        make_sorted(std::integer_sequence<V, v...>, std::index_sequence<i...>)
+        { return hana::make<S>(hana::integral_c<V, detail::sorted_values<V, v...>::value[i]>...); }
+
+        template <typename Xs, typename V, V ...v>
+        static constexpr auto
+        apply_default(Xs&&, std::integer_sequence<V, v...> values) {
+            return sort_impl::make_sorted(values,
+                                          std::make_index_sequence<sizeof...(v)>{});
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            using Elements = typename detail::integral_elements<
+                typename detail::decay<Xs>::type
+            >::type;
+            return sort_impl::apply_default(static_cast<Xs&&>(xs), Elements{});
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
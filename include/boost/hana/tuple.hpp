@@ -25,13 +25,25 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/operators/iterable.hpp>
 #include <boost/hana/detail/operators/monad.hpp>
 #include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/detail/tuple_algorithms.hpp>
+#include <boost/hana/fwd/append.hpp>
 #include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
 #include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/drop_back.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/index_if.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/insert_range.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/optional.hpp>
+#include <boost/hana/fwd/prepend.hpp>
+#include <boost/hana/fwd/remove_at.hpp>
+#include <boost/hana/fwd/remove_range.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/slice.hpp>
+#include <boost/hana/fwd/take_back.hpp>
 #include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/type.hpp> // required by fwd decl of tuple_t
 
@@ -52,6 +64,8 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         struct from_index_sequence_t { };
 
+        struct from_elements_t { };
+
         template <typename Tuple, typename ...Yn>
         struct is_same_tuple : std::false_type { };
 
@@ -98,6 +112,13 @@ BOOST_HANA_NAMESPACE_BEGIN
         { }
 
     public:
+        // Used by the structural algorithms, which already know that the
+        // elements can be constructed from `yn...`.
+        template <typename ...Yn>
+        explicit constexpr tuple(detail::from_elements_t, Yn&& ...yn)
+            : storage_(static_cast<Yn&&>(yn)...)
+        { }
+
         template <typename ...dummy, typename = typename std::enable_if<
             detail::fast_and<BOOST_HANA_TT_IS_CONSTRUCTIBLE(Xn, dummy...)...>::value
         >::type>
@@ -307,6 +328,55 @@ BOOST_HANA_NAMESPACE_BEGIN
         tuple<typename detail::decay<Xs>::type...> apply(Xs&& ...xs)
         { return {static_cast<Xs&&>(xs)...}; }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structural algorithms
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct tuple_access<tuple_tag> {
+            static constexpr basic_tuple<> storage(tuple<>&&) { return {}; }
+            static constexpr basic_tuple<> storage(tuple<>&) { return {}; }
+            static constexpr basic_tuple<> storage(tuple<> const&) { return {}; }
+
+            template <typename Xs>
+            static constexpr decltype(auto) storage(Xs&& xs)
+            { return (static_cast<Xs&&>(xs).storage_); }
+
+            static constexpr tuple<> make() { return {}; }
+
+            template <typename ...Xn>
+            static constexpr tuple<typename detail::decay<Xn>::type...>
+            make(Xn&& ...xn) {
+                return tuple<typename detail::decay<Xn>::type...>{
+                    detail::from_elements_t{}, static_cast<Xn&&>(xn)...
+                };
+            }
+        };
+    }
+
+    template <>
+    struct append_impl<tuple_tag> : detail::tuple_append<tuple_tag> { };
+    template <>
+    struct prepend_impl<tuple_tag> : detail::tuple_prepend<tuple_tag> { };
+    template <>
+    struct concat_impl<tuple_tag> : detail::tuple_concat<tuple_tag> { };
+    template <>
+    struct insert_impl<tuple_tag> : detail::tuple_insert<tuple_tag> { };
+    template <>
+    struct insert_range_impl<tuple_tag> : detail::tuple_insert_range<tuple_tag> { };
+    template <>
+    struct remove_at_impl<tuple_tag> : detail::tuple_remove_at<tuple_tag> { };
+    template <>
+    struct remove_range_impl<tuple_tag> : detail::tuple_remove_range<tuple_tag> { };
+    template <>
+    struct slice_impl<tuple_tag> : detail::tuple_slice<tuple_tag> { };
+    template <>
+    struct reverse_impl<tuple_tag> : detail::tuple_reverse<tuple_tag> { };
+    template <>
+    struct take_back_impl<tuple_tag> : detail::tuple_take_back<tuple_tag> { };
+    template <>
+    struct drop_back_impl<tuple_tag> : detail::tuple_drop_back<tuple_tag> { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_TUPLE_HPP
@@ -0,0 +1,294 @@
+/*!
+@file
+Defines `boost::hana::tuple_builder`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_BUILDER_HPP
+#define BOOST_HANA_TUPLE_BUILDER_HPP
+
+#include <boost/hana/fwd/tuple_builder.hpp>
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //////////////////////////////////////////////////////////////////////////
+    // tuple_builder
+    //
+    // A non-empty builder is a link holding a reference to the builder it
+    // extends, and its last element. `Prev` is the type of that reference,
+    // and `X` is either a reference to the last element, or its type when
+    // the link owns it. Hence, appending to a builder never touches the
+    // previous links, and the elements are only moved or copied once, when
+    // the builder is unpacked.
+    //
+    // The size of the builder is stored in the link, so that it is computed
+    // when the link is created instead of by walking all the previous links.
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <>
+    struct tuple_builder<> {
+        static constexpr std::size_t size_ = 0;
+
+        constexpr tuple_builder() = default;
+    };
+
+    template <std::size_t n, typename Prev, typename X>
+    struct tuple_builder<hana::size_t<n>, Prev, X> {
+        static constexpr std::size_t size_ = n;
+        using last_type = X;
+
+        Prev prev_;
+        X last_;
+    };
+    //! @endcond
+
+    template <typename ...Links>
+    struct tag_of<tuple_builder<Links...>> {
+        using type = tuple_builder_tag;
+    };
+
+    template <>
+    struct make_impl<tuple_builder_tag> {
+        static constexpr tuple_builder<> apply() { return {}; }
+    };
+
+    namespace detail {
+        // The type of the link extending `Builder` with an element of type
+        // `X`, which is a reference unless the link owns the element.
+        template <typename Builder, typename X>
+        using builder_link = tuple_builder<
+            hana::size_t<detail::decay<Builder>::type::size_ + 1>, Builder&&, X
+        >;
+
+        // Returns the last element of a non-empty builder, forwarded as it
+        // was pushed. An element owned by the link is returned as an rvalue,
+        // which requires the link not to be const; only the algorithms of
+        // the library create such links, and they never make them const.
+        template <typename Builder>
+        constexpr typename Builder::last_type&& builder_last(Builder& builder) {
+            using X = typename Builder::last_type;
+            return static_cast<X&&>(builder.last_);
+        }
+
+        template <bool reversed, typename Builder, typename F, typename ...X>
+        constexpr decltype(auto) unpack_builder(Builder& builder, F&& f, X&& ...x);
+
+        // Walks the links of a builder from the last one, `n` links at a
+        // time, collecting the elements in front of the ones collected so
+        // far (or after them if `reversed`), and calls `f` with all of them
+        // once it reaches the empty builder.
+        template <bool reversed, std::size_t n>
+        struct unpack_builder_links;
+
+        template <bool reversed>
+        struct unpack_builder_links<reversed, 0> {
+            template <typename Builder, typename F, typename ...X>
+            static constexpr decltype(auto) apply(Builder&, F&& f, X&& ...x)
+            { return static_cast<F&&>(f)(static_cast<X&&>(x)...); }
+        };
+
+        template <>
+        struct unpack_builder_links<false, 1> {
+            template <typename Builder, typename F, typename ...X>
+            static constexpr decltype(auto) apply(Builder& b, F&& f, X&& ...x) {
+                return detail::unpack_builder<false>(b.prev_, static_cast<F&&>(f),
+                    detail::builder_last(b), static_cast<X&&>(x)...);
+            }
+        };
+
+        template <>
+        struct unpack_builder_links<true, 1> {
+            template <typename Builder, typename F, typename ...X>
+            static constexpr decltype(auto) apply(Builder& b, F&& f, X&& ...x) {
+                return detail::unpack_builder<true>(b.prev_, static_cast<F&&>(f),
+                    static_cast<X&&>(x)..., detail::builder_last(b));
+            }
+        };
+
+        template <>
+        struct unpack_builder_links<false, 4> {
+            template <typename Builder, typename F, typename ...X>
+            static constexpr decltype(auto) apply(Builder& b, F&& f, X&& ...x) {
+                auto& b1 = b.prev_;
+                auto& b2 = b1.prev_;
+                auto& b3 = b2.prev_;
+                return detail::unpack_builder<false>(b3.prev_, static_cast<F&&>(f),
+                    detail::builder_last(b3), detail::builder_last(b2),
+                    detail::builder_last(b1), detail::builder_last(b),
+                    static_cast<X&&>(x)...);
+            }
+        };
+
+        template <>
+        struct unpack_builder_links<true, 4> {
+            template <typename Builder, typename F, typename ...X>
+            static constexpr decltype(auto) apply(Builder& b, F&& f, X&& ...x) {
+                auto& b1 = b.prev_;
+                auto& b2 = b1.prev_;
+                auto& b3 = b2.prev_;
+                return detail::unpack_builder<true>(b3.prev_, static_cast<F&&>(f),
+                    static_cast<X&&>(x)...,
+                    detail::builder_last(b), detail::builder_last(b1),
+                    detail::builder_last(b2), detail::builder_last(b3));
+            }
+        };
+
+        //! @ingroup group-details
+        //! Calls `f` with the elements of a builder, in the order in which
+        //! they were pushed (or in the reverse order if `reversed`), followed
+        //! (or preceded) by `x...`.
+        //!
+        //! Each element is forwarded as it was pushed, so the elements pushed
+        //! as rvalues are moved from.
+        template <bool reversed, typename Builder, typename F, typename ...X>
+        constexpr decltype(auto) unpack_builder(Builder& builder, F&& f, X&& ...x) {
+            constexpr std::size_t size = detail::decay<Builder>::type::size_;
+            constexpr std::size_t n = size >= 4 ? 4 : size >= 1 ? 1 : 0;
+            return unpack_builder_links<reversed, n>::apply(
+                builder, static_cast<F&&>(f), static_cast<X&&>(x)...
+            );
+        }
+
+        //! @ingroup group-details
+        //! Function object creating the `S` holding the elements of a builder,
+        //! in the order in which they were pushed, or in the reverse order if
+        //! `reversed`.
+        template <typename S, bool reversed = false>
+        struct make_from_builder {
+            template <typename Builder>
+            constexpr auto operator()(Builder&& builder) const
+            { return detail::unpack_builder<reversed>(builder, hana::make<S>); }
+        };
+
+        //! @ingroup group-details
+        //! Folds `f` over `x...` starting with a builder, and returns `k`
+        //! applied to the resulting builder.
+        //!
+        //! `f` extends the builder it is given with one element. Since a
+        //! builder refers to the builders it extends, the intermediate
+        //! builders must still exist when `k` consumes the last one. They
+        //! are temporaries of the expression in which `k` is called, which
+        //! is why the fold calls `k` instead of returning the builder. Four
+        //! steps are performed per level of recursion, like `foldl1` does.
+        template <typename F, typename K>
+        struct fold_builder {
+            F const& f;
+            K const& k;
+
+            template <typename B>
+            constexpr decltype(auto) operator()(B&& b) const
+            { return k(static_cast<B&&>(b)); }
+
+            template <typename B, typename X1>
+            constexpr decltype(auto) operator()(B&& b, X1&& x1) const
+            { return k(f(static_cast<B&&>(b), static_cast<X1&&>(x1))); }
+
+            template <typename B, typename X1, typename X2>
+            constexpr decltype(auto) operator()(B&& b, X1&& x1, X2&& x2) const {
+                return k(f(f(static_cast<B&&>(b), static_cast<X1&&>(x1)),
+                                                  static_cast<X2&&>(x2)));
+            }
+
+            template <typename B, typename X1, typename X2, typename X3>
+            constexpr decltype(auto)
+            operator()(B&& b, X1&& x1, X2&& x2, X3&& x3) const {
+                return k(f(f(f(static_cast<B&&>(b), static_cast<X1&&>(x1)),
+                                                    static_cast<X2&&>(x2)),
+                                                    static_cast<X3&&>(x3)));
+            }
+
+            template <typename B, typename X1, typename X2, typename X3,
+                      typename X4, typename ...Xn>
+            constexpr decltype(auto)
+            operator()(B&& b, X1&& x1, X2&& x2, X3&& x3, X4&& x4, Xn&& ...xn) const {
+                return (*this)(f(f(f(f(static_cast<B&&>(b), static_cast<X1&&>(x1)),
+                                                            static_cast<X2&&>(x2)),
+                                                            static_cast<X3&&>(x3)),
+                                                            static_cast<X4&&>(x4)),
+                               static_cast<Xn&&>(xn)...);
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // push_back
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename Builder, typename X>
+    constexpr auto push_back_t::operator()(Builder&& builder, X&& x) const {
+        return detail::builder_link<Builder, X&&>{static_cast<Builder&&>(builder),
+                                                  static_cast<X&&>(x)};
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // build_tuple
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename F>
+        struct build_tuple_from {
+            F const& f;
+
+            template <typename ...Xn>
+            constexpr auto operator()(Xn&& ...xn) const {
+                using K = detail::make_from_builder<tuple_tag>;
+                return detail::fold_builder<F, K>{f, K{}}(
+                    hana::make_tuple_builder(), static_cast<Xn&&>(xn)...
+                );
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr auto build_tuple_t::operator()(Xs&& xs, F const& f) const {
+        return hana::unpack(static_cast<Xs&&>(xs),
+                            detail::build_tuple_from<F>{f});
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<tuple_builder_tag> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f)
+        { return detail::unpack_builder<false>(xs, static_cast<F&&>(f)); }
+    };
+
+    template <>
+    struct length_impl<tuple_builder_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&) {
+            return hana::size_t<Xs::size_>{};
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversion to a tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<tuple_tag, tuple_builder_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs)
+        { return detail::make_from_builder<tuple_tag>{}(xs); }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_TUPLE_BUILDER_HPP
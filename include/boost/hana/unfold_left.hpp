@@ -12,15 +12,14 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/unfold_left.hpp>
 
-#include <boost/hana/append.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/empty.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/unfold.hpp>
 #include <boost/hana/first.hpp>
-#include <boost/hana/functional/partial.hpp>
-#include <boost/hana/optional.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/tuple_builder.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -42,27 +41,18 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    //////////////////////////////////////////////////////////////////////////
+    // The generator produces the elements from the last one to the first one.
+    // They are accumulated in a `tuple_builder` by `detail::unfold`, and the
+    // sequence is created in a single pass by reading the builder backwards.
+    //////////////////////////////////////////////////////////////////////////
     template <typename S, bool condition>
     struct unfold_left_impl<S, when<condition>> : default_ {
-        struct unfold_left_helper {
-            template <typename F, typename P>
-            constexpr auto operator()(F&& f, P&& p) const {
-                return hana::append(
-                    unfold_left_impl::apply(
-                        hana::first(static_cast<P&&>(p)),
-                        static_cast<F&&>(f)
-                    ),
-                    hana::second(static_cast<P&&>(p))
-                );
-            }
-        };
-
         template <typename Init, typename F>
         static constexpr auto apply(Init&& init, F&& f) {
-            decltype(auto) elt = f(static_cast<Init&&>(init));
-            return hana::maybe(empty<S>(),
-                hana::partial(unfold_left_helper{}, static_cast<F&&>(f)),
-                static_cast<decltype(elt)&&>(elt)
+            using K = detail::make_from_builder<S, true>;
+            return detail::unfold<F, hana::second_t, hana::first_t, K>{f, K{}}(
+                static_cast<Init&&>(init)
             );
         }
     };
@@ -15,12 +15,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/empty.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/unfold.hpp>
 #include <boost/hana/first.hpp>
-#include <boost/hana/functional/partial.hpp>
-#include <boost/hana/optional.hpp>
-#include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/tuple_builder.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -42,30 +41,22 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    //////////////////////////////////////////////////////////////////////////
+    // The elements are accumulated in a `tuple_builder` by `detail::unfold`,
+    // in the order in which they are produced, and the sequence is created
+    // in a single pass at the end.
+    //////////////////////////////////////////////////////////////////////////
     template <typename S, bool condition>
     struct unfold_right_impl<S, when<condition>> : default_ {
-        struct unfold_right_helper {
-            template <typename F, typename P>
-            constexpr auto operator()(F&& f, P&& p) const {
-                return hana::prepend(
-                    unfold_right_impl::apply(
-                        hana::second(static_cast<P&&>(p)),
-                        static_cast<F&&>(f)
-                    ),
-                    hana::first(static_cast<P&&>(p))
-                );
-            }
-        };
-
         template <typename Init, typename F>
         static constexpr auto apply(Init&& init, F&& f) {
-            decltype(auto) elt = f(static_cast<Init&&>(init));
-            return hana::maybe(hana::empty<S>(),
-                hana::partial(unfold_right_helper{}, static_cast<F&&>(f)),
-                static_cast<decltype(elt)&&>(elt)
+            using K = detail::make_from_builder<S>;
+            return detail::unfold<F, hana::first_t, hana::second_t, K>{f, K{}}(
+                static_cast<Init&&>(init)
             );
         }
     };
+
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_UNFOLD_RIGHT_HPP
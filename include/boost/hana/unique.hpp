@@ -15,12 +15,20 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/integral_elements.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
 #include <boost/hana/equal.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/group.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/transform.hpp>
 
+#include <cstddef>
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -56,6 +64,48 @@ BOOST_HANA_NAMESPACE_BEGIN
     }
     //! @endcond
 
+    namespace detail {
+        // These are only used with at least one value.
+        template <typename V, V ...v>
+        constexpr std::size_t unique_values_count() {
+            constexpr V values[] = {v...};
+            std::size_t n = 1;
+            for (std::size_t i = 1; i != sizeof...(v); ++i)
+                if (!(values[i - 1] == values[i]))
+                    ++n;
+            return n;
+        }
+
+        template <typename V, V ...v>
+        constexpr detail::array<V, unique_values_count<V, v...>()>
+        make_unique_values() {
+            constexpr V values[] = {v...};
+            detail::array<V, unique_values_count<V, v...>()> result{};
+            std::size_t n = 0;
+            result[n++] = values[0];
+            for (std::size_t i = 1; i != sizeof...(v); ++i)
+                if (!(values[i - 1] == values[i]))
+                    result[n++] = values[i];
+            return result;
+        }
+
+        // The values are computed once, when the data members are
+        // initialized, instead of once per element of the result.
+        template <typename V, V ...v>
+        struct unique_values {
+            static constexpr std::size_t count = unique_values_count<V, v...>();
+            static constexpr detail::array<V, count> value =
+                make_unique_values<V, v...>();
+        };
+
+        template <typename V, V ...v>
+        constexpr std::size_t unique_values<V, v...>::count;
+
+        template <typename V, V ...v>
+        constexpr detail::array<V, unique_values<V, v...>::count>
+        unique_values<V, v...>::value;
+    }
+
     template <typename S, bool condition>
     struct unique_impl<S, when<condition>> : default_ {
         template <typename Xs, typename Pred>
@@ -67,8 +117,32 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
 
         template <typename Xs>
-        static constexpr auto apply(Xs&& xs)
+        static constexpr auto
+        apply_default(Xs&& xs, detail::not_integral_elements)
         { return unique_impl::apply(static_cast<Xs&&>(xs), hana::equal); }
+
+        // When all the elements are `integral_constant`s of the same type,
+        // consecutive duplicates are removed with a `constexpr` loop over
+        // their values, without grouping the elements.
+        template <typename V, V ...v, std::size_t ...i>
+        static constexpr auto
+        make_unique(std::integer_sequence<V, v...>, std::index_sequence<i...>)
+        { return hana::make<S>(hana::integral_c<V, detail::unique_values<V, v...>::value[i]>...); }
+
+        template <typename Xs, typename V, V ...v>
+        static constexpr auto
+        apply_default(Xs&&, std::integer_sequence<V, v...> values) {
+            constexpr std::size_t n = detail::unique_values<V, v...>::count;
+            return unique_impl::make_unique(values, std::make_index_sequence<n>{});
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            using Elements = typename detail::integral_elements<
+                typename detail::decay<Xs>::type
+            >::type;
+            return unique_impl::apply_default(static_cast<Xs&&>(xs), Elements{});
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
@@ -0,0 +1,67 @@
+/*!
+@file
+Defines `boost::hana::unroll`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_UNROLL_HPP
+#define BOOST_HANA_UNROLL_HPP
+
+#include <boost/hana/fwd/unroll.hpp>
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        template <std::size_t Stride, typename F, std::size_t ...k>
+        BOOST_HANA_ALWAYS_INLINE constexpr void
+        unroll_block(std::size_t start, F& f, std::index_sequence<k...>) {
+            int expand[] = {0, ((void)f(start + k * Stride,
+                                        hana::size_c<k * Stride>), 0)...};
+            (void)expand; (void)start; (void)f;
+        }
+    }
+
+    //! @cond
+    template <std::size_t N, std::size_t Block>
+    struct unroll_t {
+        static_assert(N == 0 || Block > 0,
+        "hana::unroll<N, Block> requires 'Block' to be positive");
+
+        // `unroll<0>` has a `Block` of 0, but it has nothing to iterate over.
+        static constexpr std::size_t block = Block > 0 ? Block : 1;
+
+        template <std::size_t Stride, typename F>
+        BOOST_HANA_ALWAYS_INLINE constexpr void
+        operator()(hana::size_t<Stride>, F&& f) const {
+            static_assert(Stride > 0,
+            "hana::unroll<N, Block>(stride, f) requires 'stride' to be positive");
+
+            constexpr std::size_t count = (N + Stride - 1) / Stride;
+            constexpr std::size_t step = block * Stride;
+            constexpr std::size_t blocks = count / block;
+
+            for (std::size_t b = 0; b != blocks; ++b)
+                detail::unroll_block<Stride>(b * step, f,
+                    std::make_index_sequence<block>{});
+
+            detail::unroll_block<Stride>(blocks * step, f,
+                std::make_index_sequence<count % block>{});
+        }
+
+        template <typename F>
+        BOOST_HANA_ALWAYS_INLINE constexpr void operator()(F&& f) const
+        { (*this)(hana::size_c<1>, f); }
+    };
+    //! @endcond
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_UNROLL_HPP
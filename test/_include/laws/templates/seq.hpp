@@ -108,11 +108,23 @@ int main() {
 #endif
 
     //////////////////////////////////////////////////////////////////////////
-    // Functor, Applicative, Monad
+    // Functor
     //////////////////////////////////////////////////////////////////////////
-#ifdef BOOST_HANA_TEST_MONAD
+#ifdef BOOST_HANA_TEST_FUNCTOR
     hana::test::TestFunctor<::Seq>{eqs, eq_keys};
+#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Applicative
+    //////////////////////////////////////////////////////////////////////////
+#ifdef BOOST_HANA_TEST_APPLICATIVE
     hana::test::TestApplicative<::Seq>{eqs};
+#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monad
+    //////////////////////////////////////////////////////////////////////////
+#ifdef BOOST_HANA_TEST_MONAD
     hana::test::TestMonad<::Seq>{eqs, nested_eqs};
 #endif
 
@@ -28,8 +28,15 @@ int main() {
         ct_eq<2>{},
         ct_eq<4>{}
     );
+    (void)eq_values;
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestFunctor<hana::basic_tuple_tag>{eq_tuples, eq_values};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestFoldable<hana::basic_tuple_tag>{eq_tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestIterable<hana::basic_tuple_tag>{eq_tuples};
+#endif
 }
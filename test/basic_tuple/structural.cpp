@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/prepend.hpp>
+
+#include <laws/base.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto xs = hana::make_basic_tuple(ct_eq<0>{}, ct_eq<1>{});
+
+    {
+        auto ys = hana::append(xs, ct_eq<2>{});
+        static_assert(std::is_same<
+            decltype(ys), hana::basic_tuple<ct_eq<0>, ct_eq<1>, ct_eq<2>>
+        >{}, "");
+    }
+    {
+        auto ys = hana::prepend(xs, ct_eq<2>{});
+        static_assert(std::is_same<
+            decltype(ys), hana::basic_tuple<ct_eq<2>, ct_eq<0>, ct_eq<1>>
+        >{}, "");
+    }
+    {
+        auto ys = hana::concat(xs, hana::make_basic_tuple(ct_eq<2>{}));
+        static_assert(std::is_same<
+            decltype(ys), hana::basic_tuple<ct_eq<0>, ct_eq<1>, ct_eq<2>>
+        >{}, "");
+    }
+    {
+        auto ys = hana::concat(hana::make_basic_tuple(), hana::make_basic_tuple());
+        static_assert(std::is_same<decltype(ys), hana::basic_tuple<>>{}, "");
+    }
+
+    // The elements are decayed, like with make_basic_tuple
+    {
+        int i = 0;
+        hana::basic_tuple<int const&> refs{i};
+        auto ys = hana::append(refs, 1);
+        static_assert(std::is_same<decltype(ys), hana::basic_tuple<int, int>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 1);
+    }
+}
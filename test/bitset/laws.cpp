@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/searchable.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto eqs = hana::make_tuple(
+        hana::bitset_c<int>,
+        hana::bitset_c<int, 0>,
+        hana::bitset_c<int, 0, 1>,
+        hana::bitset_c<int, 1, 63>,
+        hana::bitset_c<int, 0, 64, 200>
+    );
+
+    auto keys = hana::make_tuple(
+        hana::int_c<1>,
+        hana::int_c<64>,
+        hana::int_c<65>
+    );
+
+    hana::test::TestComparable<hana::bitset_tag>{eqs};
+    hana::test::TestSearchable<hana::bitset_tag>{eqs, keys};
+    hana::test::TestFoldable<hana::bitset_tag>{eqs};
+}
@@ -0,0 +1,76 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not_equal.hpp>
+
+#include <cstdint>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    // the representation is canonical
+    {
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<int>), hana::bitset<int> const
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<int, 0, 3>), hana::bitset<int, 9> const
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<int, 3, 0, 3>), hana::bitset<int, 9> const
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<unsigned, 63, 64>),
+            hana::bitset<unsigned, std::uint64_t{1} << 63, 1> const
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<int, 128>), hana::bitset<int, 0, 0, 1> const
+        >{}, "");
+    }
+
+    // make_bitset
+    {
+        static_assert(std::is_same<
+            decltype(hana::make_bitset()), hana::bitset<int>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::make_bitset(hana::int_c<3>, hana::int_c<0>)),
+            std::remove_const_t<decltype(hana::bitset_c<int, 0, 3>)>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::make_bitset(hana::int_c<3>, hana::int_c<3>)),
+            std::remove_const_t<decltype(hana::bitset_c<int, 3>)>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::make_bitset(hana::int_c<3>, hana::long_c<5>)),
+            std::remove_const_t<decltype(hana::bitset_c<long, 3, 5>)>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(hana::make_bitset(std::integral_constant<char, 1>{})),
+            std::remove_const_t<decltype(hana::bitset_c<char, 1>)>
+        >{}, "");
+    }
+
+    // size and value_type
+    {
+        static_assert(decltype(hana::bitset_c<int>)::size == 0, "");
+        static_assert(decltype(hana::bitset_c<int, 0, 64, 200>)::size == 3, "");
+        static_assert(std::is_same<
+            decltype(hana::bitset_c<short, 1>)::value_type, short
+        >{}, "");
+    }
+
+    // bitsets compare equal regardless of the type of their keys
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::bitset_c<int, 1, 2> == hana::bitset_c<long, 2, 1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::bitset_c<int, 1, 2> != hana::bitset_c<int, 1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::bitset_c<int> != hana::bitset_c<int, 0>);
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto xs = hana::bitset_c<int, 0, 2, 64, 130>;
+
+    // contains with IntegralConstants only tests a bit
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(xs, hana::int_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(xs, hana::int_c<130>));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(xs, hana::long_c<64>));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(xs, std::integral_constant<unsigned, 2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(xs, hana::int_c<1>)));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(xs, hana::int_c<-1>)));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(xs, hana::int_c<1000>)));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(hana::bitset_c<int>, hana::int_c<0>)));
+    }
+
+    // other keys are compared with the elements
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(xs, hana::type_c<int>)));
+        BOOST_HANA_RUNTIME_CHECK(hana::contains(xs, 64));
+        BOOST_HANA_RUNTIME_CHECK(!hana::contains(xs, 65));
+    }
+
+    // find
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::find(xs, hana::long_c<64>) == hana::just(hana::int_c<64>));
+        static_assert(std::is_same<
+            decltype(hana::find(xs, hana::long_c<64>)),
+            decltype(hana::just(hana::int_c<64>))
+        >{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::find(xs, hana::int_c<3>) == hana::nothing);
+        BOOST_HANA_CONSTANT_CHECK(hana::find(xs, hana::type_c<int>) == hana::nothing);
+    }
+
+    // at_key and operator[]
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::at_key(xs, hana::int_c<2>) == hana::int_c<2>);
+        BOOST_HANA_CONSTANT_CHECK(xs[hana::int_c<130>] == hana::int_c<130>);
+    }
+
+    // find_if and any_of
+    {
+        auto greater_than_100 = [](auto x) { return hana::bool_c<(decltype(x)::value > 100)>; };
+        BOOST_HANA_CONSTANT_CHECK(hana::find_if(xs, greater_than_100) == hana::just(hana::int_c<130>));
+        BOOST_HANA_CONSTANT_CHECK(hana::any_of(xs, greater_than_100));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::any_of(hana::bitset_c<int, 1, 2>, greater_than_100)));
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/difference.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/is_subset.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/symmetric_difference.hpp>
+#include <boost/hana/union.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto xs = hana::bitset_c<int, 0, 2, 64, 130>;
+    constexpr auto ys = hana::bitset_c<int, 2, 3, 130>;
+    constexpr auto empty = hana::bitset_c<int>;
+
+    // union_
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::union_(xs, ys) == hana::bitset_c<int, 0, 2, 3, 64, 130>);
+        BOOST_HANA_CONSTANT_CHECK(hana::union_(ys, xs) == hana::bitset_c<int, 0, 2, 3, 64, 130>);
+        BOOST_HANA_CONSTANT_CHECK(hana::union_(xs, empty) == xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::union_(empty, empty) == empty);
+
+        // the keys have the common type of both bitsets
+        static_assert(std::is_same<
+            decltype(hana::union_(hana::bitset_c<int, 1>, hana::bitset_c<long, 2>)),
+            std::remove_const_t<decltype(hana::bitset_c<long, 1, 2>)>
+        >{}, "");
+    }
+
+    // intersection
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::intersection(xs, ys) == hana::bitset_c<int, 2, 130>);
+        BOOST_HANA_CONSTANT_CHECK(hana::intersection(ys, xs) == hana::bitset_c<int, 2, 130>);
+        BOOST_HANA_CONSTANT_CHECK(hana::intersection(xs, empty) == empty);
+
+        // trailing empty words are removed
+        static_assert(std::is_same<
+            decltype(hana::intersection(xs, hana::bitset_c<int, 0, 200>)),
+            std::remove_const_t<decltype(hana::bitset_c<int, 0>)>
+        >{}, "");
+    }
+
+    // difference
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::difference(xs, ys) == hana::bitset_c<int, 0, 64>);
+        BOOST_HANA_CONSTANT_CHECK(hana::difference(ys, xs) == hana::bitset_c<int, 3>);
+        BOOST_HANA_CONSTANT_CHECK(hana::difference(xs, xs) == empty);
+        BOOST_HANA_CONSTANT_CHECK(hana::difference(xs, empty) == xs);
+    }
+
+    // symmetric_difference
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::symmetric_difference(xs, ys) == hana::bitset_c<int, 0, 3, 64>);
+        BOOST_HANA_CONSTANT_CHECK(hana::symmetric_difference(ys, xs) == hana::bitset_c<int, 0, 3, 64>);
+        BOOST_HANA_CONSTANT_CHECK(hana::symmetric_difference(xs, xs) == empty);
+    }
+
+    // insert
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::insert(empty, hana::int_c<5>) == hana::bitset_c<int, 5>);
+        BOOST_HANA_CONSTANT_CHECK(hana::insert(xs, hana::int_c<1>) == hana::bitset_c<int, 0, 1, 2, 64, 130>);
+        BOOST_HANA_CONSTANT_CHECK(hana::insert(xs, hana::int_c<0>) == xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::insert(xs, hana::size_c<300>) == hana::bitset_c<int, 0, 2, 64, 130, 300>);
+    }
+
+    // erase_key
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::erase_key(xs, hana::int_c<130>) == hana::bitset_c<int, 0, 2, 64>);
+        BOOST_HANA_CONSTANT_CHECK(hana::erase_key(xs, hana::int_c<1>) == xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::erase_key(xs, hana::int_c<500>) == xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::erase_key(empty, hana::int_c<0>) == empty);
+    }
+
+    // is_subset
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::is_subset(empty, xs));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_subset(xs, xs));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_subset(hana::bitset_c<int, 2, 130>, xs));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_subset(ys, xs)));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_subset(xs, empty)));
+    }
+}
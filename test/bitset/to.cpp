@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bitset.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // bitset -> set
+    {
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::to<hana::set_tag>(hana::bitset_c<int>) == hana::make_set()
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::to<hana::set_tag>(hana::bitset_c<int, 70, 1>) ==
+            hana::make_set(hana::int_c<1>, hana::int_c<70>)
+        );
+    }
+
+    // Foldable -> bitset
+    {
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::to<hana::bitset_tag>(hana::make_set(hana::int_c<1>, hana::int_c<70>)) ==
+            hana::bitset_c<int, 1, 70>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::to<hana::bitset_tag>(hana::tuple_c<int, 3, 1, 3>) ==
+            hana::bitset_c<int, 1, 3>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::to<hana::bitset_tag>(hana::make_tuple()) == hana::bitset_c<int>
+        );
+    }
+
+    // the keys are unpacked in increasing order
+    {
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::unpack(hana::bitset_c<int, 130, 0, 64, 2>, hana::make_tuple) ==
+            hana::tuple_c<int, 0, 2, 64, 130>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            hana::length(hana::bitset_c<int, 130, 0, 64, 2>) == hana::size_c<4>
+        );
+    }
+}
@@ -12,7 +12,24 @@ struct method_impl : hana::default_ { };
 template <>
 struct method_impl<int> { };
 
+template <>
+struct method_impl<char> : private hana::default_ { };
+
+template <>
+struct method_impl<long> : method_impl<void>, method_impl<float> { };
+
+template <>
+struct method_impl<double>;
+
 static_assert(hana::is_default<method_impl<void>>{}, "");
+static_assert(hana::is_default<hana::default_>{}, "");
 static_assert(!hana::is_default<method_impl<int>>{}, "");
 
+// default_ must be a public and unambiguous base
+static_assert(!hana::is_default<method_impl<char>>{}, "");
+static_assert(!hana::is_default<method_impl<long>>{}, "");
+
+// an incomplete implementation is not a default implementation
+static_assert(!hana::is_default<method_impl<double>>{}, "");
+
 int main() { }
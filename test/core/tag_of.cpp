@@ -25,6 +25,14 @@ struct test {
     static_assert(std::is_same<hana::tag_of_t<T const&&>, ExpectedDatatype>::value, "");
     static_assert(std::is_same<hana::tag_of_t<T volatile&&>, ExpectedDatatype>::value, "");
     static_assert(std::is_same<hana::tag_of_t<T const volatile&&>, ExpectedDatatype>::value, "");
+
+    // The metafunction itself must also strip references and cv-qualifiers
+    static_assert(std::is_same<typename hana::tag_of<T const&>::type, ExpectedDatatype>::value, "");
+    static_assert(std::is_same<typename hana::tag_of<T volatile&>::type, ExpectedDatatype>::value, "");
+    static_assert(std::is_same<typename hana::tag_of<T const volatile&>::type, ExpectedDatatype>::value, "");
+    static_assert(std::is_same<typename hana::tag_of<T const&&>::type, ExpectedDatatype>::value, "");
+    static_assert(std::is_same<typename hana::tag_of<T volatile&&>::type, ExpectedDatatype>::value, "");
+    static_assert(std::is_same<typename hana::tag_of<T const volatile&&>::type, ExpectedDatatype>::value, "");
 };
 
 struct NestedDatatype;
@@ -47,6 +47,7 @@ constexpr bool constexpr_context() {
     hana::detail::accumulate(first, last, 1, hana::mult);
 
     hana::detail::min_element(first, last);
+    hana::detail::max_element(first, last);
 
     return true;
 }
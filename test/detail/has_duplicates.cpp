@@ -3,7 +3,12 @@
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/type.hpp>
+
+#include <utility>
 namespace hana = boost::hana;
 
 
@@ -54,4 +59,64 @@ static_assert(hana::detail::has_duplicates<
     hana::int_<0>, hana::int_<1>, hana::int_<2>, hana::long_<1>
 >::value, "");
 
+static_assert(hana::detail::has_duplicates<
+    hana::type<int>, hana::type<char>, hana::type<int>
+>::value, "");
+
+static_assert(!hana::detail::has_duplicates<
+    hana::type<int>, hana::type<char>, hana::type<int const>
+>::value, "");
+
+// Make sure keys with the same hash are still compared
+template <int i>
+struct colliding { };
+
+struct colliding_tag;
+
+namespace boost { namespace hana {
+    template <int i>
+    struct tag_of<colliding<i>> { using type = colliding_tag; };
+
+    template <>
+    struct hash_impl<colliding_tag> {
+        template <typename X>
+        static constexpr hana::type<void> apply(X const&) { return {}; }
+    };
+
+    template <>
+    struct equal_impl<colliding_tag, colliding_tag> {
+        template <int i, int j>
+        static constexpr hana::bool_<i == j> apply(colliding<i> const&, colliding<j> const&)
+        { return {}; }
+    };
+}}
+
+static_assert(!hana::detail::has_duplicates<
+    colliding<0>, colliding<1>, colliding<2>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    colliding<0>, colliding<1>, colliding<2>, colliding<1>
+>::value, "");
+
+static_assert(!hana::detail::has_duplicates<
+    hana::int_<0>, colliding<0>, hana::int_<1>, colliding<1>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    hana::int_<0>, colliding<0>, hana::int_<1>, colliding<0>
+>::value, "");
+
+// Make sure it works with many keys
+template <typename Indices, int duplicate>
+struct many_ints;
+
+template <std::size_t ...i, int duplicate>
+struct many_ints<std::index_sequence<i...>, duplicate>
+    : hana::detail::has_duplicates<hana::int_<i>..., hana::int_<duplicate>>
+{ };
+
+static_assert(!many_ints<std::make_index_sequence<300>, 300>::value, "");
+static_assert(many_ints<std::make_index_sequence<300>, 150>::value, "");
+
 int main() { }
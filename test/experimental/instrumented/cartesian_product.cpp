@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+
+
+int main() {
+    // Every element of the result must be copied at most once, and moved
+    // at most once, since elements may appear several times in the result.
+    // Here, there are 2 * 3 = 6 products of 2 elements each.
+    {
+        auto xs = hana::make_tuple(
+            hana::make_tuple(instrumented<int>{1}, instrumented<int>{2}),
+            hana::make_tuple(instrumented<int>{3}, instrumented<int>{4},
+                             instrumented<int>{5})
+        );
+        auto counts = hana::experimental::count_operations([&] {
+            return hana::cartesian_product(std::move(xs));
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies <= 6 * 2);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves <= 6 * 2);
+    }
+    {
+        auto xs = hana::make_tuple(
+            hana::make_tuple(instrumented<int>{1}, instrumented<int>{2}),
+            hana::make_tuple(instrumented<int>{3}, instrumented<int>{4},
+                             instrumented<int>{5})
+        );
+        auto counts = hana::experimental::count_operations([&] {
+            return hana::cartesian_product(xs);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies <= 6 * 2);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves <= 6 * 2);
+    }
+}
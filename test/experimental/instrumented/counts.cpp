@@ -0,0 +1,98 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+
+
+struct other_tag;
+
+int main() {
+    // default construction, construction from a value and destruction
+    {
+        auto counts = hana::experimental::count_operations([] {
+            instrumented<int> a{};
+            instrumented<int> b{3};
+            BOOST_HANA_RUNTIME_CHECK(a.value == 0);
+            BOOST_HANA_RUNTIME_CHECK(b.value == 3);
+            return 0;
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions == 2);
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.destructions == 2);
+    }
+
+    // copies and moves
+    {
+        instrumented<int> x{1};
+        auto counts = hana::experimental::count_operations([&] {
+            instrumented<int> copy1{x};
+            instrumented<int> const& cref = x;
+            instrumented<int> copy2{cref};
+            instrumented<int> moved{std::move(copy1)};
+            BOOST_HANA_RUNTIME_CHECK(moved.value == 1);
+            return 0;
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 2);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.destructions == 3);
+    }
+
+    // assignments
+    {
+        instrumented<int> x{1}, y{2};
+        auto counts = hana::experimental::count_operations([&] {
+            x = y;
+            y = std::move(x);
+            return 0;
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copy_assignments == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.move_assignments == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.destructions == 0);
+    }
+
+    // the result of the function is destroyed before counting
+    {
+        auto counts = hana::experimental::count_operations([] {
+            return instrumented<int>{1};
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.destructions == 1);
+    }
+
+    // different tags are counted separately
+    {
+        auto counts = hana::experimental::count_operations<other_tag>([] {
+            instrumented<int> x{1};
+            instrumented<int, other_tag> y{1};
+            instrumented<int, other_tag> z{y};
+            return 0;
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 1);
+        BOOST_HANA_RUNTIME_CHECK(counts.destructions == 2);
+    }
+
+    // the global counts can be inspected directly
+    {
+        auto before = hana::experimental::instrumentation();
+        { instrumented<int> x{1}; }
+        auto after = hana::experimental::instrumentation();
+        BOOST_HANA_RUNTIME_CHECK((after - before).constructions == 1);
+        BOOST_HANA_RUNTIME_CHECK((after - before).destructions == 1);
+    }
+
+    // comparisons use the held value
+    {
+        BOOST_HANA_RUNTIME_CHECK(instrumented<int>{1} == instrumented<int>{1});
+        BOOST_HANA_RUNTIME_CHECK(instrumented<int>{1} != instrumented<int>{2});
+        BOOST_HANA_RUNTIME_CHECK(instrumented<int>{1} < instrumented<int>{2});
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+
+
+template <typename F>
+void check_moves_only(F f, std::size_t max_moves) {
+    auto counts = hana::experimental::count_operations(f);
+    BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+    BOOST_HANA_RUNTIME_CHECK(counts.moves <= max_moves);
+}
+
+auto make_xs() {
+    return hana::make_tuple(instrumented<int>{1}, instrumented<int>{2},
+                            instrumented<int>{3});
+}
+
+int main() {
+    // Structural algorithms on rvalue tuples move every element at most once.
+    {
+        auto xs = make_xs();
+        check_moves_only([&] { return hana::reverse(std::move(xs)); }, 3);
+    }
+    {
+        auto xs = make_xs();
+        instrumented<int> x{4};
+        check_moves_only([&] { return hana::append(std::move(xs), std::move(x)); }, 4);
+    }
+    {
+        auto xs = make_xs();
+        auto ys = make_xs();
+        check_moves_only([&] { return hana::concat(std::move(xs), std::move(ys)); }, 6);
+    }
+    {
+        auto xs = make_xs();
+        check_moves_only([&] {
+            return hana::filter(std::move(xs), [](auto const&) { return hana::true_c; });
+        }, 3);
+    }
+    {
+        auto xs = make_xs();
+        check_moves_only([&] { return hana::remove_at_c<1>(std::move(xs)); }, 2);
+    }
+
+    // Folding with a function taking its arguments by reference performs
+    // no copies and no moves at all.
+    {
+        auto xs = make_xs();
+        check_moves_only([&] {
+            return hana::fold_left(std::move(xs), 0, [](int s, auto const& x) {
+                return s + x.value;
+            });
+        }, 0);
+    }
+}
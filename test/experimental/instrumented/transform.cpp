@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+
+
+int main() {
+    auto forward = [](auto&& x) -> decltype(auto) {
+        return static_cast<decltype(x)&&>(x);
+    };
+    auto by_value = [](auto x) { return x; };
+
+    // transform of an rvalue tuple performs zero copies
+    {
+        auto xs = hana::make_tuple(instrumented<int>{1}, instrumented<int>{2},
+                                   instrumented<int>{3});
+        auto counts = hana::experimental::count_operations([&] {
+            return hana::transform(std::move(xs), forward);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves <= 3);
+    }
+    {
+        auto xs = hana::make_tuple(instrumented<int>{1}, instrumented<int>{2},
+                                   instrumented<int>{3});
+        auto counts = hana::experimental::count_operations([&] {
+            return hana::transform(std::move(xs), by_value);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves <= 3 * 3);
+    }
+
+    // transform of an lvalue tuple copies each element exactly once
+    {
+        auto xs = hana::make_tuple(instrumented<int>{1}, instrumented<int>{2},
+                                   instrumented<int>{3});
+        auto counts = hana::experimental::count_operations([&] {
+            return hana::transform(xs, forward);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 3);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 0);
+    }
+}
@@ -0,0 +1,124 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parse.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+namespace ex = hana::experimental;
+
+
+template <typename S, typename P, typename ...Captures>
+void check_match(S s, P p, Captures ...captures) {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::parse(s, p),
+        hana::just(hana::make_tuple(captures...))
+    ));
+}
+
+template <typename S, typename P>
+void check_no_match(S s, P p) {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(ex::parse(s, p), hana::nothing));
+}
+
+int main() {
+    auto empty = BOOST_HANA_STRING("");
+
+    // literals
+    {
+        check_match(empty, empty);
+        check_match(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc"));
+        check_match(BOOST_HANA_STRING("abc"), ex::lit(BOOST_HANA_STRING("abc")));
+        check_match(BOOST_HANA_STRING("a"), ex::ch<'a'>);
+        check_no_match(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("abc"));
+        check_no_match(BOOST_HANA_STRING("abcd"), BOOST_HANA_STRING("abc"));
+        check_no_match(BOOST_HANA_STRING("abd"), BOOST_HANA_STRING("abc"));
+        check_no_match(empty, ex::ch<'a'>);
+    }
+
+    // character classes
+    {
+        check_match(BOOST_HANA_STRING("7"), ex::digit);
+        check_no_match(BOOST_HANA_STRING("x"), ex::digit);
+        check_match(BOOST_HANA_STRING("x"), ex::alpha);
+        check_match(BOOST_HANA_STRING("X"), ex::alpha);
+        check_no_match(BOOST_HANA_STRING("_"), ex::alpha);
+        check_match(BOOST_HANA_STRING("7"), ex::alnum);
+        check_match(BOOST_HANA_STRING("\t"), ex::space);
+        check_match(BOOST_HANA_STRING("?"), ex::any_char);
+        check_no_match(empty, ex::any_char);
+        check_match(BOOST_HANA_STRING("c"), ex::char_in<'a', 'f'>);
+        check_no_match(BOOST_HANA_STRING("g"), ex::char_in<'a', 'f'>);
+        check_match(BOOST_HANA_STRING("+"), ex::one_of(BOOST_HANA_STRING("+-")));
+        check_no_match(BOOST_HANA_STRING("*"), ex::one_of(BOOST_HANA_STRING("+-")));
+    }
+
+    // sequences and alternatives
+    {
+        auto p = ex::seq(ex::ch<'a'>, ex::alt(ex::ch<'b'>, ex::ch<'c'>), ex::ch<'d'>);
+        check_match(BOOST_HANA_STRING("abd"), p);
+        check_match(BOOST_HANA_STRING("acd"), p);
+        check_no_match(BOOST_HANA_STRING("add"), p);
+        check_no_match(BOOST_HANA_STRING("ab"), p);
+
+        check_match(empty, ex::seq());
+        check_no_match(empty, ex::alt());
+
+        // Alternatives are ordered, and there is no backtracking.
+        check_no_match(BOOST_HANA_STRING("ab"), ex::seq(
+            ex::alt(ex::ch<'a'>, BOOST_HANA_STRING("ab")), ex::ch<'b'>, ex::ch<'b'>
+        ));
+    }
+
+    // repetitions
+    {
+        check_match(empty, ex::many(ex::digit));
+        check_match(BOOST_HANA_STRING("123"), ex::many(ex::digit));
+        check_no_match(BOOST_HANA_STRING("12a"), ex::many(ex::digit));
+        check_no_match(empty, ex::some(ex::digit));
+        check_match(BOOST_HANA_STRING("1"), ex::some(ex::digit));
+        check_match(BOOST_HANA_STRING("123"), ex::some(ex::digit));
+        check_match(empty, ex::opt(ex::digit));
+        check_match(BOOST_HANA_STRING("1"), ex::opt(ex::digit));
+        check_no_match(BOOST_HANA_STRING("12"), ex::opt(ex::digit));
+
+        // A repetition of a parser matching the empty string terminates.
+        check_match(empty, ex::many(ex::many(ex::digit)));
+        check_match(BOOST_HANA_STRING("12"), ex::many(ex::opt(ex::digit)));
+    }
+
+    // captures
+    {
+        check_match(BOOST_HANA_STRING("abc"), ex::capture(BOOST_HANA_STRING("abc")),
+                    BOOST_HANA_STRING("abc"));
+
+        auto assignment = ex::seq(
+            ex::capture(ex::some(ex::alpha)), ex::many(ex::space), ex::ch<'='>,
+            ex::many(ex::space), ex::capture(ex::seq(ex::opt(ex::ch<'-'>), ex::some(ex::digit)))
+        );
+        check_match(BOOST_HANA_STRING("x = -42"), assignment,
+                    BOOST_HANA_STRING("x"), BOOST_HANA_STRING("-42"));
+        check_match(BOOST_HANA_STRING("abc=1"), assignment,
+                    BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("1"));
+        check_no_match(BOOST_HANA_STRING("abc="), assignment);
+
+        // Nested captures are in the order in which they appear.
+        check_match(BOOST_HANA_STRING("ab"),
+            ex::capture(ex::seq(ex::capture(ex::ch<'a'>), ex::capture(ex::ch<'b'>))),
+            BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b"));
+
+        // The last match of a repeated capture is kept.
+        check_match(BOOST_HANA_STRING("a,b,c"),
+            ex::seq(ex::alpha, ex::many(ex::seq(ex::ch<','>, ex::capture(ex::alpha)))),
+            BOOST_HANA_STRING("c"));
+
+        // The captures of an alternative that was not taken are empty.
+        check_match(BOOST_HANA_STRING("b"),
+            ex::alt(ex::seq(ex::capture(ex::alpha), ex::digit), ex::capture(ex::alpha)),
+            empty, BOOST_HANA_STRING("b"));
+    }
+}
@@ -0,0 +1,74 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parse.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+namespace ex = hana::experimental;
+
+
+int main() {
+    auto empty = BOOST_HANA_STRING("");
+    auto slash = ex::ch<'/'>;
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(empty, slash),
+        hana::make_tuple(empty)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("abc"), slash),
+        hana::make_tuple(BOOST_HANA_STRING("abc"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("/"), slash),
+        hana::make_tuple(empty, empty)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("/users//:id/"), slash),
+        hana::make_tuple(empty, BOOST_HANA_STRING("users"), empty,
+                         BOOST_HANA_STRING(":id"), empty)
+    ));
+
+    // With a separator of several characters
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("a, b,c ,  d"),
+                  ex::seq(ex::many(ex::space), ex::ch<','>, ex::many(ex::space))),
+        hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b"),
+                         BOOST_HANA_STRING("c"), BOOST_HANA_STRING("d"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("a::b:c"), BOOST_HANA_STRING("::")),
+        hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b:c"))
+    ));
+
+    // Separators matching the empty string are ignored.
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ex::split(BOOST_HANA_STRING("ab"), ex::many(slash)),
+        hana::make_tuple(BOOST_HANA_STRING("ab"))
+    ));
+
+    // Long strings don't require a deep recursion.
+    {
+        auto path = BOOST_HANA_STRING(
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa/"
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        );
+        auto pieces = ex::split(path, slash);
+        BOOST_HANA_CONSTANT_CHECK(hana::length(pieces) == hana::size_c<10>);
+        BOOST_HANA_CONSTANT_CHECK(hana::length(hana::at_c<9>(pieces)) == hana::size_c<99>);
+    }
+}
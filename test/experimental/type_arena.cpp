@@ -0,0 +1,180 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/experimental/type_arena.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+using hana::experimental::type_arena;
+
+
+int live = 0;
+
+struct Tracked {
+    int value;
+    explicit Tracked(int v) : value(v) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    ~Tracked() { --live; }
+};
+
+struct alignas(128) Wide { char c; };
+
+template <typename T>
+bool is_aligned(T const* p, std::size_t alignment)
+{ return reinterpret_cast<std::uintptr_t>(p) % alignment == 0; }
+
+int main() {
+    // emplace, operator[] and growth
+    {
+        type_arena<Tracked, std::string> arena;
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() == 0);
+
+        std::vector<hana::experimental::type_arena_handle<Tracked>> handles;
+        for (int i = 0; i != 100; ++i)
+            handles.push_back(arena.emplace(hana::type_c<Tracked>, i));
+        auto s = arena.emplace(hana::type_c<std::string>, "abc");
+
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() >= 100);
+        BOOST_HANA_RUNTIME_CHECK(live == 100);
+        for (int i = 0; i != 100; ++i)
+            BOOST_HANA_RUNTIME_CHECK(arena[handles[i]].value == i);
+        BOOST_HANA_RUNTIME_CHECK(arena[s] == "abc");
+
+        auto const& carena = arena;
+        BOOST_HANA_RUNTIME_CHECK(carena[s] == "abc");
+        static_assert(std::is_same<decltype(carena[s]), std::string const&>{}, "");
+    }
+    BOOST_HANA_RUNTIME_CHECK(live == 0);
+
+    // the arguments of emplace may refer to objects of the arena, even if
+    // it grows
+    {
+        type_arena<std::string> arena;
+        auto h = arena.emplace(hana::type_c<std::string>, 40, 'x');
+        for (int i = 1; i != 8; ++i)
+            arena.emplace(hana::type_c<std::string>, "abc");
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() == 8);
+
+        auto copy = arena.emplace(hana::type_c<std::string>, arena[h]);
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() == 16);
+        BOOST_HANA_RUNTIME_CHECK(arena[copy] == std::string(40, 'x'));
+        BOOST_HANA_RUNTIME_CHECK(arena[h] == std::string(40, 'x'));
+    }
+
+    // erase and reuse of slots
+    {
+        type_arena<Tracked> arena{4};
+        auto a = arena.emplace(hana::type_c<Tracked>, 1);
+        auto b = arena.emplace(hana::type_c<Tracked>, 2);
+        auto c = arena.emplace(hana::type_c<Tracked>, 3);
+
+        arena.erase(b);
+        BOOST_HANA_RUNTIME_CHECK(live == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(arena, hana::type_c<Tracked>).size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(arena[a].value == 1);
+        BOOST_HANA_RUNTIME_CHECK(arena[c].value == 3);
+
+        auto d = arena.emplace(hana::type_c<Tracked>, 4);
+        BOOST_HANA_RUNTIME_CHECK(d.index == b.index);
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() == 4);
+
+        std::vector<int> values;
+        hana::at_key(arena, hana::type_c<Tracked>).for_each([&](Tracked& t) {
+            values.push_back(t.value);
+        });
+        BOOST_HANA_RUNTIME_CHECK((values == std::vector<int>{1, 4, 3}));
+
+        arena.erase(a);
+        arena.erase(c);
+        arena.erase(d);
+        BOOST_HANA_RUNTIME_CHECK(live == 0);
+        arena.emplace(hana::type_c<Tracked>, 5);
+        arena.emplace(hana::type_c<Tracked>, 6);
+        BOOST_HANA_RUNTIME_CHECK(live == 2);
+    }
+    BOOST_HANA_RUNTIME_CHECK(live == 0);
+
+    // chunks are aligned on cache lines and share a single allocation
+    {
+        type_arena<char, Wide, double> arena{3};
+        auto c = arena.emplace(hana::type_c<char>, 'x');
+        auto w = arena.emplace(hana::type_c<Wide>, Wide{'y'});
+        auto d = arena.emplace(hana::type_c<double>, 1.5);
+
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(&arena[c], 64));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(&arena[w], 128));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(&arena[d], 64));
+        BOOST_HANA_RUNTIME_CHECK(&arena[c] < reinterpret_cast<char*>(&arena[w]));
+        BOOST_HANA_RUNTIME_CHECK(reinterpret_cast<char*>(&arena[w]) <
+                                 reinterpret_cast<char*>(&arena[d]));
+        BOOST_HANA_RUNTIME_CHECK(arena[w].c == 'y');
+    }
+
+    // for_each_type
+    {
+        type_arena<int, std::string> arena;
+        arena.emplace(hana::type_c<int>, 1);
+        arena.emplace(hana::type_c<int>, 2);
+        arena.emplace(hana::type_c<std::string>, "s");
+
+        std::vector<std::size_t> sizes;
+        arena.for_each_type([&](auto chunk) { sizes.push_back(chunk.size()); });
+        BOOST_HANA_RUNTIME_CHECK((sizes == std::vector<std::size_t>{2, 1}));
+
+        int sum = 0;
+        auto const& carena = arena;
+        carena.for_each_type([&](auto chunk) {
+            chunk.for_each([&](auto const& x) { sum += static_cast<int>(sizeof(x)); });
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 2 * static_cast<int>(sizeof(int)) +
+                                        static_cast<int>(sizeof(std::string)));
+    }
+
+    // moving
+    {
+        type_arena<Tracked> arena;
+        auto h = arena.emplace(hana::type_c<Tracked>, 7);
+        type_arena<Tracked> moved{std::move(arena)};
+        BOOST_HANA_RUNTIME_CHECK(moved[h].value == 7);
+        BOOST_HANA_RUNTIME_CHECK(arena.capacity() == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(arena, hana::type_c<Tracked>).size() == 0);
+
+        arena = std::move(moved);
+        BOOST_HANA_RUNTIME_CHECK(arena[h].value == 7);
+        BOOST_HANA_RUNTIME_CHECK(live == 1);
+    }
+    BOOST_HANA_RUNTIME_CHECK(live == 0);
+
+    // Searchable
+    {
+        type_arena<int, char> arena;
+        auto i = arena.emplace(hana::type_c<int>, 3);
+
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(arena, hana::type_c<int>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(arena, hana::type_c<float>)));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_nothing(hana::find(arena, hana::type_c<float>)));
+
+        auto chunk = hana::find(arena, hana::type_c<int>).value();
+        BOOST_HANA_RUNTIME_CHECK(chunk[i] == 3);
+        chunk[i] = 4;
+        BOOST_HANA_RUNTIME_CHECK(arena[i] == 4);
+
+        auto const& carena = arena;
+        auto cchunk = hana::at_key(carena, hana::type_c<int>);
+        static_assert(std::is_same<decltype(cchunk[i]), int const&>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(cchunk.size() == 1);
+    }
+}
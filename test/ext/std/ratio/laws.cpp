@@ -28,10 +28,16 @@ int main() {
         , std::ratio<2, 1>{}
     );
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestComparable<hana::ext::std::ratio_tag>{ratios};
     hana::test::TestOrderable<hana::ext::std::ratio_tag>{ratios};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestMonoid<hana::ext::std::ratio_tag>{ratios};
     hana::test::TestGroup<hana::ext::std::ratio_tag>{ratios};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestRing<hana::ext::std::ratio_tag>{ratios};
     hana::test::TestEuclideanRing<hana::ext::std::ratio_tag>{ratios};
+#endif
 }
@@ -35,9 +35,15 @@ int main() {
         , std::make_tuple(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{}, ct_ord<4>{})
     );
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestComparable<hana::ext::std::tuple_tag>{eq_tuples};
     hana::test::TestOrderable<hana::ext::std::tuple_tag>{ord_tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestFoldable<hana::ext::std::tuple_tag>{eq_tuples};
     hana::test::TestIterable<hana::ext::std::tuple_tag>{eq_tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestSequence<hana::ext::std::tuple_tag>{};
+#endif
 }
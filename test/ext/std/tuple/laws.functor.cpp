@@ -48,8 +48,16 @@ int main() {
         hana::always(hana::false_c), hana::always(hana::true_c)
     );
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestFunctor<hana::ext::std::tuple_tag>{tuples, values};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestApplicative<hana::ext::std::tuple_tag>{tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestMonad<hana::ext::std::tuple_tag>{tuples, nested_tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 4
     hana::test::TestMonadPlus<hana::ext::std::tuple_tag>{tuples, predicates, values};
+#endif
 }
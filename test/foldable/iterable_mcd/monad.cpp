@@ -3,5 +3,13 @@
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
 #define BOOST_HANA_TEST_FOLDABLE_ITERABLE_MCD
-#define BOOST_HANA_TEST_MONAD
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
+#   define BOOST_HANA_TEST_FUNCTOR
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
+#   define BOOST_HANA_TEST_APPLICATIVE
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
+#   define BOOST_HANA_TEST_MONAD
+#endif
 #include <laws/templates/seq.hpp>
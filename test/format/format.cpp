@@ -0,0 +1,95 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include <climits>
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename Formatter, typename ...Args>
+std::string format(Formatter f, Args const& ...args) {
+    char buffer[128];
+    char* end = f(buffer, buffer + sizeof(buffer), args...);
+    BOOST_HANA_RUNTIME_CHECK(end != nullptr);
+    return std::string(buffer, end);
+}
+
+int main() {
+    // literal text and escapes
+    {
+        BOOST_HANA_RUNTIME_CHECK(format(hana::format(BOOST_HANA_STRING(""))) == "");
+        BOOST_HANA_RUNTIME_CHECK(format(hana::format(BOOST_HANA_STRING("abc"))) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(format(hana::format(BOOST_HANA_STRING("{{}}"))) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(format(hana::format(BOOST_HANA_STRING("{{{}}}")), 1) == "{1}");
+        BOOST_HANA_RUNTIME_CHECK(format(hana::format(BOOST_HANA_STRING("{}{}")), 1, 2) == "12");
+
+        auto none = hana::format(BOOST_HANA_STRING(""));
+        auto two = hana::format(BOOST_HANA_STRING("a{}b{{}}{}"));
+        static_assert(decltype(none)::placeholders == 0, "");
+        static_assert(decltype(two)::placeholders == 2, "");
+    }
+
+    // integers
+    {
+        auto f = hana::format(BOOST_HANA_STRING("<{}>"));
+        BOOST_HANA_RUNTIME_CHECK(format(f, 0) == "<0>");
+        BOOST_HANA_RUNTIME_CHECK(format(f, 42) == "<42>");
+        BOOST_HANA_RUNTIME_CHECK(format(f, -42) == "<-42>");
+        BOOST_HANA_RUNTIME_CHECK(format(f, INT_MIN) == "<" + std::to_string(INT_MIN) + ">");
+        BOOST_HANA_RUNTIME_CHECK(format(f, LLONG_MIN) == "<" + std::to_string(LLONG_MIN) + ">");
+        BOOST_HANA_RUNTIME_CHECK(format(f, ULLONG_MAX) == "<" + std::to_string(ULLONG_MAX) + ">");
+        BOOST_HANA_RUNTIME_CHECK(format(f, static_cast<unsigned char>(255)) == "<255>");
+        BOOST_HANA_RUNTIME_CHECK(format(f, static_cast<short>(-7)) == "<-7>");
+    }
+
+    // bool and char
+    {
+        auto f = hana::format(BOOST_HANA_STRING("{} {} {}"));
+        BOOST_HANA_RUNTIME_CHECK(format(f, true, false, 'x') == "true false x");
+    }
+
+    // floating point, with the shortest representation that round-trips
+#ifdef BOOST_HANA_FORMAT_HAS_TO_CHARS
+    {
+        auto f = hana::format(BOOST_HANA_STRING("{}"));
+        BOOST_HANA_RUNTIME_CHECK(format(f, 0.5) == "0.5");
+        BOOST_HANA_RUNTIME_CHECK(format(f, -2.25f) == "-2.25");
+        BOOST_HANA_RUNTIME_CHECK(format(f, 3.0) == "3");
+        BOOST_HANA_RUNTIME_CHECK(format(f, 0.1f) == "0.1");
+        BOOST_HANA_RUNTIME_CHECK(format(f, 1e21) == "1e+21");
+
+        auto g = hana::format(BOOST_HANA_STRING("{} {}"));
+        BOOST_HANA_RUNTIME_CHECK(format(g, 123456789.0, 0.1 + 0.2) ==
+                                 "123456789 0.30000000000000004");
+    }
+#endif
+
+    // strings
+    {
+        auto f = hana::format(BOOST_HANA_STRING("[{}|{}|{}]"));
+        std::string s = "std";
+        BOOST_HANA_RUNTIME_CHECK(format(f, "ptr", s, BOOST_HANA_STRING("hana")) == "[ptr|std|hana]");
+        BOOST_HANA_RUNTIME_CHECK(format(f, "", std::string{}, BOOST_HANA_STRING("")) == "[||]");
+    }
+
+    // the buffer is too small
+    {
+        auto f = hana::format(BOOST_HANA_STRING("ab{}cd"));
+        char buffer[8];
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, buffer + 5, 1) == buffer + 5);
+        BOOST_HANA_RUNTIME_CHECK(std::memcmp(buffer, "ab1cd", 5) == 0);
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, buffer + 4, 1) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, buffer + 2, 1) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, buffer + 4, 12345) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, buffer, "x") == nullptr);
+
+        auto empty = hana::format(BOOST_HANA_STRING(""));
+        BOOST_HANA_RUNTIME_CHECK(empty(buffer, buffer) == buffer);
+    }
+}
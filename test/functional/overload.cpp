@@ -0,0 +1,87 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/functional/overload.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+
+#include <laws/base.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+struct x { };
+
+template <int i>
+struct f {
+    constexpr ct_eq<i> operator()(x<i>) const { return {}; }
+};
+
+struct move_only {
+    move_only() = default;
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+    ct_eq<999> operator()(x<999>) const { return {}; }
+};
+
+ct_eq<1000> fptr(x<1000>) { return {}; }
+
+template <typename F, int i>
+void check(F const& overloaded, x<i>) {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(overloaded(x<i>{}), ct_eq<i>{}));
+}
+
+template <int ...i>
+void check_all() {
+    auto overloaded = hana::overload(f<i>{}...);
+    using swallow = int[];
+    (void)swallow{0, (check(overloaded, x<i>{}), 0)...};
+}
+
+int main() {
+    // 1 function: the function itself is returned
+    {
+        auto f0 = hana::overload(f<0>{});
+        static_assert(std::is_same<decltype(f0), f<0>>{}, "");
+    }
+
+    // Various numbers of functions, which exercises different shapes of
+    // the underlying inheritance tree
+    check_all<0, 1>();
+    check_all<0, 1, 2>();
+    check_all<0, 1, 2, 3>();
+    check_all<0, 1, 2, 3, 4>();
+    check_all<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16>();
+    check_all<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+              17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+              32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46>();
+
+    // Function pointers mixed with function objects
+    {
+        auto overloaded = hana::overload(f<0>{}, &fptr, f<1>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(overloaded(x<0>{}), ct_eq<0>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(overloaded(x<1>{}), ct_eq<1>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(overloaded(x<1000>{}), ct_eq<1000>{}));
+    }
+
+    // Move-only function objects are moved into the overload set
+    {
+        auto overloaded = hana::overload(f<0>{}, move_only{}, f<1>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(overloaded(x<999>{}), ct_eq<999>{}));
+    }
+
+    // The result can be copied
+    {
+        auto overloaded = hana::overload(f<0>{}, f<1>{}, f<2>{});
+        auto copy = overloaded;
+        auto const& ref = overloaded;
+        auto copy2 = ref;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(copy(x<2>{}), ct_eq<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(copy2(x<1>{}), ct_eq<1>{}));
+    }
+}
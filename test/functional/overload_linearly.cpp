@@ -8,6 +8,8 @@
 #include <boost/hana/equal.hpp>
 
 #include <laws/base.hpp>
+
+#include <utility>
 namespace hana = boost::hana;
 using hana::test::ct_eq;
 
@@ -119,4 +121,67 @@ int main() {
             f(A{})
         ));
     }
+
+    // many functions
+    {
+        auto f = hana::overload_linearly(
+            [](C) { return ct_eq<0>{}; },
+            [](C) { return ct_eq<1>{}; },
+            [](C) { return ct_eq<2>{}; },
+            [](C) { return ct_eq<3>{}; },
+            [](B) { return ct_eq<4>{}; },
+            [](C) { return ct_eq<5>{}; },
+            [](A) { return ct_eq<6>{}; },
+            [](B) { return ct_eq<7>{}; }
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            f(C{}),
+            ct_eq<0>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            f(B{}),
+            ct_eq<4>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            f(AA{}),
+            ct_eq<6>{}
+        ));
+    }
+
+    // functions after the first viable one are never instantiated
+    {
+        auto f = hana::overload_linearly(
+            [](B) { return ct_eq<0>{}; },
+            [](A) { return ct_eq<1>{}; },
+            [](auto x) { return x.not_a_member(); },
+            [](auto x) { return x.not_a_member(); }
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            f(A{}),
+            ct_eq<1>{}
+        ));
+    }
+
+    // rvalue and non-const lvalue overload sets
+    {
+        auto f = hana::overload_linearly(
+            [](A) { return ct_eq<0>{}; },
+            [](B) { return ct_eq<1>{}; },
+            [](C) { return ct_eq<2>{}; }
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            f(B{}),
+            ct_eq<1>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            std::move(f)(C{}),
+            ct_eq<2>{}
+        ));
+    }
 }
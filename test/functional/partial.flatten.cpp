@@ -0,0 +1,76 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/functional/curry.hpp>
+#include <boost/hana/functional/partial.hpp>
+
+#include <laws/base.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct f_t {
+    template <typename ...X>
+    constexpr int operator()(X ...) const { return sizeof...(X); }
+};
+
+int main() {
+    hana::test::_injection<0> f{};
+
+    // partial applications are flattened
+    {
+        auto p = hana::partial(hana::partial(f, ct_eq<1>{}), ct_eq<2>{});
+        static_assert(std::is_same<
+            decltype(p),
+            decltype(hana::partial(f, ct_eq<1>{}, ct_eq<2>{}))
+        >{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            p(ct_eq<3>{}),
+            f(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+        ));
+
+        auto const q = hana::partial(f, ct_eq<1>{});
+        auto r = hana::partial(q, ct_eq<2>{}, ct_eq<3>{});
+        static_assert(std::is_same<
+            decltype(r),
+            decltype(hana::partial(f, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}))
+        >{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::partial(r)(),
+            f(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+        ));
+    }
+
+    // stored arguments are moved out of rvalue partial applications,
+    // and copied out of lvalue ones
+    {
+        std::string s(100, 'x');
+        auto p = hana::partial(f_t{}, s);
+        auto q = hana::partial(p, 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(p.storage_) == s);
+        auto r = hana::partial(std::move(q), 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(q.storage_).empty());
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(r.storage_) == s);
+        BOOST_HANA_RUNTIME_CHECK(r(3) == 4);
+    }
+
+    // curried functions store their arguments flat
+    {
+        constexpr auto c = hana::curry<4>(f_t{});
+        static_assert(std::is_same<
+            decltype(c(1)(2)(3)),
+            hana::curry_t<1, decltype(hana::partial(f_t{}, 1, 2, 3))>
+        >{}, "");
+        static_assert(c(1)(2)(3)(4) == 4, "");
+        static_assert(c(1, 2)(3, 4) == 4, "");
+        static_assert(c(1, 2, 3, 4) == 4, "");
+        static_assert(sizeof(c(1)(2)(3)) == sizeof(hana::partial(f_t{}, 1, 2, 3)), "");
+    }
+}
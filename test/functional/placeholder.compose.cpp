@@ -0,0 +1,90 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::_;
+
+
+struct extra_t { virtual ~extra_t() { } };
+extra_t extra{};
+
+constexpr struct { } invalid{};
+
+template <typename ...> using bool_t = bool;
+constexpr bool valid_call(...) { return false; }
+template <typename F, typename ...Args>
+constexpr auto valid_call(F&& f, Args&& ...args)
+    -> bool_t<decltype(std::forward<F>(f)(std::forward<Args>(args)...))>
+{ return true; }
+
+template <typename F>
+struct nested_size;
+
+template <typename ...Steps>
+struct nested_size<hana::placeholder_detail::pipeline<Steps...>> {
+    static constexpr int value = sizeof...(Steps);
+};
+
+int main() {
+    // binary operators applied to an expression
+    {
+        static_assert((_ * 2 + 1)(3) == 7, "");
+        static_assert((1 + _ * 2)(3) == 7, "");
+        static_assert((10 - (_ + 1))(3) == 6, "");
+        static_assert(((_ + 1) - 10)(3) == -6, "");
+        static_assert((_ * 2 + 1 < 10)(3), "");
+        static_assert(!(_ * 2 + 1 < 10)(5), "");
+        static_assert(((_ + 1) * (2))(3) == 8, "");
+        static_assert((2 * (1 + _) - 1)(3) == 7, "");
+        static_assert((_ % 3 == 0)(9), "");
+        static_assert(((_ | 1) << 2)(2) == 12, "");
+
+        BOOST_HANA_RUNTIME_CHECK((_ * 2 + 1)(3, extra) == 7);
+        BOOST_HANA_RUNTIME_CHECK((_ * 2 + 1)(3, extra, extra) == 7);
+    }
+
+    // unary operators applied to an expression
+    {
+        static_assert((-(_ + 1))(3) == -4, "");
+        static_assert((!(_ == 3))(4), "");
+        static_assert((~(_ & 1))(3) == ~1, "");
+
+        int const xs[] = {2, 3};
+        BOOST_HANA_RUNTIME_CHECK((-_[1] + 1)(xs) == -2);
+        BOOST_HANA_RUNTIME_CHECK((*_(0) + 1)([](int) { return "ab"; }) == 'a' + 1);
+    }
+
+    // the composed function objects stay flat
+    {
+        static_assert(nested_size<decltype(_ * 2 + 1)>::value == 2, "");
+        static_assert(nested_size<decltype(_ * 2 + 1 - 3)>::value == 3, "");
+        static_assert(nested_size<decltype(-(1 + _ * 2) - 3)>::value == 4, "");
+    }
+
+    // SFINAE-friendliness
+    {
+        static_assert(!valid_call(_ * 2 + 1), "");
+        static_assert(!valid_call(_ * 2 + 1, invalid), "");
+        static_assert(!valid_call(-(_ + 1), invalid), "");
+        static_assert(valid_call(_ * 2 + 1, 3), "");
+    }
+
+    // values are moved into the function object, and out of it when the
+    // function object is an rvalue
+    {
+        std::string s = "abc";
+        auto f = _ + s + "!";
+        BOOST_HANA_RUNTIME_CHECK(f(std::string{">"}) == ">abc!");
+        BOOST_HANA_RUNTIME_CHECK(s == "abc");
+        BOOST_HANA_RUNTIME_CHECK(std::move(f)(std::string{">"}) == ">abc!");
+
+        auto const g = std::string{"<"} + (_ + s);
+        BOOST_HANA_RUNTIME_CHECK(g(std::string{"-"}) == "<-abc");
+    }
+}
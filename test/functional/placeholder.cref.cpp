@@ -0,0 +1,103 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+using hana::_;
+
+
+template <typename T, typename = void>
+struct can_cref : std::false_type { };
+
+template <typename T>
+struct can_cref<T, decltype((void)hana::cref(std::declval<T>()))>
+    : std::true_type
+{ };
+
+struct Tracked {
+    static int copies;
+    int value;
+    constexpr explicit Tracked(int v) : value{v} { }
+    Tracked(Tracked const& other) : value{other.value} { ++copies; }
+    friend constexpr bool operator==(Tracked const& a, int b) { return a.value == b; }
+    friend constexpr bool operator==(int a, Tracked const& b) { return a == b.value; }
+    friend constexpr int operator+(Tracked const& a, int b) { return a.value + b; }
+};
+int Tracked::copies = 0;
+
+constexpr int one = 1;
+
+int main() {
+    // cref'd operands are not copied
+    {
+        Tracked t{3};
+        Tracked::copies = 0;
+
+        auto eq_right = _ == hana::cref(t);
+        auto eq_left = hana::cref(t) == _;
+        BOOST_HANA_RUNTIME_CHECK(eq_right(3));
+        BOOST_HANA_RUNTIME_CHECK(eq_left(3));
+        BOOST_HANA_RUNTIME_CHECK(!std::move(eq_right)(4));
+        BOOST_HANA_RUNTIME_CHECK(!std::move(eq_left)(4));
+        BOOST_HANA_RUNTIME_CHECK(Tracked::copies == 0);
+
+        // but they are copied without cref
+        auto eq_copy = _ == t;
+        BOOST_HANA_RUNTIME_CHECK(eq_copy(3));
+        BOOST_HANA_RUNTIME_CHECK(Tracked::copies == 1);
+    }
+
+    // cref'd operands are references to the original object
+    {
+        std::string s = "abc";
+        auto f = _ + hana::cref(s);
+        BOOST_HANA_RUNTIME_CHECK(f(std::string{">"}) == ">abc");
+        s = "def";
+        BOOST_HANA_RUNTIME_CHECK(f(std::string{">"}) == ">def");
+        BOOST_HANA_RUNTIME_CHECK(std::move(f)(std::string{">"}) == ">def");
+        BOOST_HANA_RUNTIME_CHECK(s == "def");
+    }
+
+    // in subscripts and calls
+    {
+        int const xs[] = {1, 2, 3};
+        int const i = 2;
+        BOOST_HANA_RUNTIME_CHECK(_[hana::cref(i)](xs) == 3);
+
+        Tracked t{5};
+        Tracked::copies = 0;
+        auto call = _(hana::cref(t), 1);
+        BOOST_HANA_RUNTIME_CHECK(call([](Tracked const& x, int y) { return x + y; }) == 6);
+        BOOST_HANA_RUNTIME_CHECK(Tracked::copies == 0);
+    }
+
+    // in composed expressions
+    {
+        Tracked t{5};
+        Tracked::copies = 0;
+        auto f = _ + 1 == hana::cref(t);
+        BOOST_HANA_RUNTIME_CHECK(f(4));
+        BOOST_HANA_RUNTIME_CHECK(!f(5));
+        BOOST_HANA_RUNTIME_CHECK(Tracked::copies == 0);
+    }
+
+    // in constant expressions
+    {
+        static_assert((_ + hana::cref(one))(2) == 3, "");
+        static_assert((hana::cref(one) + _)(2) == 3, "");
+    }
+
+    // temporaries can't be captured by reference
+    {
+        static_assert(!can_cref<std::string>{}, "");
+        static_assert(!can_cref<std::string const>{}, "");
+        static_assert(can_cref<std::string&>{}, "");
+        static_assert(can_cref<std::string const&>{}, "");
+    }
+}
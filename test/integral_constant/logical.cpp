@@ -45,11 +45,15 @@ int main() {
     }
 
     // laws
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestLogical<hana::integral_constant_tag<int>>{hana::make_tuple(
         hana::int_c<-2>, hana::int_c<0>, hana::int_c<1>, hana::int_c<3>
     )};
+#endif
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestLogical<hana::integral_constant_tag<bool>>{hana::make_tuple(
         hana::false_c, hana::true_c
     )};
+#endif
 }
@@ -0,0 +1,129 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/monadic_fold_left.hpp>
+#include <boost/hana/monadic_fold_right.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+// Fails on `ct_eq<0>`, and is only defined for `ct_eq`s.
+struct f_t {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const {
+        return hana::just(hana::test::_injection<0>{}(x, y));
+    }
+
+    template <typename X>
+    constexpr auto operator()(X, ct_eq<0>) const { return hana::nothing; }
+
+    template <typename Y>
+    constexpr auto operator()(ct_eq<0>, Y) const { return hana::nothing; }
+};
+
+struct undefined_step {
+    template <typename X, typename Y>
+    constexpr auto operator()(X, Y) const {
+        static_assert(sizeof(X) == 0, "the fold should have stopped");
+        return hana::nothing;
+    }
+};
+
+// Fails on the first step, and must not be used afterwards.
+struct stop_at_zero {
+    constexpr auto operator()(hana::int_<1>, hana::int_<0>) const { return hana::nothing; }
+    constexpr auto operator()(hana::int_<0>, hana::int_<1>) const { return hana::nothing; }
+
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return undefined_step{}(x, y); }
+};
+
+int main() {
+    constexpr auto f = f_t{};
+    constexpr auto g = hana::test::_injection<0>{};
+    using M = hana::optional_tag;
+
+    // monadic_fold_left
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(hana::make_tuple(), ct_eq<1>{}, f),
+            hana::just(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(hana::make_tuple(ct_eq<2>{}, ct_eq<3>{}), ct_eq<1>{}, f),
+            hana::just(g(g(ct_eq<1>{}, ct_eq<2>{}), ct_eq<3>{}))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(hana::make_tuple(ct_eq<2>{}, ct_eq<0>{}, ct_eq<3>{}), ct_eq<1>{}, f),
+            hana::nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}), f),
+            hana::just(g(g(ct_eq<1>{}, ct_eq<2>{}), ct_eq<3>{}))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(hana::make_tuple(ct_eq<1>{}, ct_eq<0>{}, ct_eq<3>{}), f),
+            hana::nothing
+        ));
+    }
+
+    // monadic_fold_right
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(hana::make_tuple(), ct_eq<1>{}, f),
+            hana::just(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(hana::make_tuple(ct_eq<2>{}, ct_eq<3>{}), ct_eq<1>{}, f),
+            hana::just(g(ct_eq<2>{}, g(ct_eq<3>{}, ct_eq<1>{})))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(hana::make_tuple(ct_eq<2>{}, ct_eq<0>{}, ct_eq<3>{}), ct_eq<1>{}, f),
+            hana::nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}), f),
+            hana::just(g(ct_eq<1>{}, g(ct_eq<2>{}, ct_eq<3>{})))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(hana::make_tuple(ct_eq<1>{}, ct_eq<0>{}, ct_eq<3>{}), f),
+            hana::nothing
+        ));
+    }
+
+    // The fold stops as soon as the state is `nothing`, even for long
+    // sequences.
+    {
+        auto xs = hana::unpack(hana::range_c<int, 0, 300>, hana::make_tuple);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_left<M>(xs, hana::int_c<1>, stop_at_zero{}),
+            hana::nothing
+        ));
+        auto ys = hana::unpack(hana::range_c<int, -299, 1>, hana::make_tuple);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::monadic_fold_right<M>(ys, hana::int_c<1>, stop_at_zero{}),
+            hana::nothing
+        ));
+    }
+
+    // With runtime values
+    {
+        auto add = [](int x, int y) { return hana::just(x + y); };
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::monadic_fold_left<M>(hana::make_tuple(1, 2, 3), 4, add).value() == 10
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::monadic_fold_right<M>(hana::make_tuple(1, 2, 3), 4, add).value() == 10
+        );
+    }
+}
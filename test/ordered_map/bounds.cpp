@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+auto p() { return hana::make_pair(hana::int_c<i>, ct_eq<i>{}); }
+
+int main() {
+    auto empty = hana::make_ordered_map();
+    auto m = hana::make_ordered_map(p<40>(), p<10>(), p<30>(), p<20>());
+
+    // lower_bound
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(empty, hana::int_c<0>) == hana::size_c<0>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<0>) == hana::size_c<0>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<10>) == hana::size_c<0>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<15>) == hana::size_c<1>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<20>) == hana::size_c<1>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<40>) == hana::size_c<3>);
+    BOOST_HANA_CONSTANT_CHECK(hana::lower_bound(m, hana::int_c<50>) == hana::size_c<4>);
+
+    // upper_bound
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(empty, hana::int_c<0>) == hana::size_c<0>);
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(m, hana::int_c<0>) == hana::size_c<0>);
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(m, hana::int_c<10>) == hana::size_c<1>);
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(m, hana::int_c<15>) == hana::size_c<1>);
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(m, hana::int_c<40>) == hana::size_c<4>);
+    BOOST_HANA_CONSTANT_CHECK(hana::upper_bound(m, hana::int_c<50>) == hana::size_c<4>);
+
+    // slice_keys
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(empty, hana::int_c<0>, hana::int_c<100>),
+        empty
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(m, hana::int_c<0>, hana::int_c<100>),
+        m
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(m, hana::int_c<20>, hana::int_c<40>),
+        hana::make_ordered_map(p<20>(), p<30>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(m, hana::int_c<11>, hana::int_c<41>),
+        hana::make_ordered_map(p<20>(), p<30>(), p<40>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(m, hana::int_c<20>, hana::int_c<20>),
+        empty
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_keys(m, hana::int_c<40>, hana::int_c<10>),
+        empty
+    ));
+}
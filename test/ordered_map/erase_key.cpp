@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return hana::make_pair(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(hana::make_ordered_map(), ct_ord<0>{}),
+        hana::make_ordered_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(hana::make_ordered_map(p<0, 0>()), ct_ord<0>{}),
+        hana::make_ordered_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(hana::make_ordered_map(p<0, 0>()), ct_ord<1>{}),
+        hana::make_ordered_map(p<0, 0>())
+    ));
+
+    auto m = hana::make_ordered_map(p<0, 0>(), p<1, 1>(), p<2, 2>());
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(m, ct_ord<0>{}),
+        hana::make_ordered_map(p<1, 1>(), p<2, 2>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(m, ct_ord<1>{}),
+        hana::make_ordered_map(p<0, 0>(), p<2, 2>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(m, ct_ord<2>{}),
+        hana::make_ordered_map(p<0, 0>(), p<1, 1>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(m, ct_ord<3>{}),
+        m
+    ));
+}
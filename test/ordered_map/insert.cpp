@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return hana::make_pair(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::insert(hana::make_ordered_map(), p<0, 0>())),
+        hana::make_tuple(p<0, 0>())
+    ));
+
+    // The new entry is inserted at its position
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::insert(hana::make_ordered_map(p<1, 1>(), p<3, 3>()), p<0, 0>())),
+        hana::make_tuple(p<0, 0>(), p<1, 1>(), p<3, 3>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::insert(hana::make_ordered_map(p<1, 1>(), p<3, 3>()), p<2, 2>())),
+        hana::make_tuple(p<1, 1>(), p<2, 2>(), p<3, 3>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::insert(hana::make_ordered_map(p<1, 1>(), p<3, 3>()), p<4, 4>())),
+        hana::make_tuple(p<1, 1>(), p<3, 3>(), p<4, 4>())
+    ));
+
+    // Existing keys are left untouched
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(hana::make_ordered_map(p<1, 1>(), p<3, 3>()), p<3, 99>()),
+        hana::make_ordered_map(p<1, 1>(), p<3, 3>())
+    ));
+
+    // The result is the same map as the one built directly
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(hana::insert(hana::make_ordered_map(p<2, 2>()), p<0, 0>()), p<1, 1>()),
+        hana::make_ordered_map(p<0, 0>(), p<1, 1>(), p<2, 2>())
+    ));
+}
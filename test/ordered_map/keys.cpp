@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return hana::make_pair(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::keys(hana::make_ordered_map())),
+        hana::make_tuple()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::keys(hana::make_ordered_map(p<2, 0>(), p<0, 1>(), p<1, 2>()))),
+        hana::make_tuple(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::values(hana::make_ordered_map(p<2, 0>(), p<0, 1>(), p<1, 2>()))),
+        hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}, ct_eq<0>{})
+    ));
+}
@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/searchable.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return hana::make_pair(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    auto eqs = hana::make_tuple(
+        hana::make_ordered_map(),
+        hana::make_ordered_map(p<0, 0>()),
+        hana::make_ordered_map(p<0, 1>()),
+        hana::make_ordered_map(p<0, 0>(), p<1, 1>()),
+        hana::make_ordered_map(p<0, 0>(), p<1, 2>()),
+        hana::make_ordered_map(p<3, 3>(), p<0, 0>(), p<1, 1>())
+    );
+
+    auto keys = hana::make_tuple(ct_ord<0>{}, ct_ord<2>{}, ct_ord<3>{});
+
+    hana::test::TestComparable<hana::ordered_map_tag>{eqs};
+    hana::test::TestSearchable<hana::ordered_map_tag>{eqs, keys};
+    hana::test::TestFoldable<hana::ordered_map_tag>{eqs};
+}
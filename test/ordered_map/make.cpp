@@ -0,0 +1,82 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/minimal_product.hpp>
+
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return ::minimal_product(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    // Entries are stored in increasing order of their keys
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::make_ordered_map()),
+        hana::make_tuple()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::make_ordered_map(p<2, 0>(), p<0, 1>(), p<1, 2>())),
+        hana::make_tuple(p<0, 1>(), p<1, 2>(), p<2, 0>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::make_ordered_map(p<4, 4>(), p<3, 3>(), p<2, 2>(),
+                                              p<1, 1>(), p<0, 0>())),
+        hana::make_tuple(p<0, 0>(), p<1, 1>(), p<2, 2>(), p<3, 3>(), p<4, 4>())
+    ));
+
+    // The type of the map only depends on the sorted entries
+    {
+        using M1 = decltype(hana::make_ordered_map(p<1, 1>(), p<0, 0>()));
+        using M2 = decltype(hana::make_ordered_map(p<0, 0>(), p<1, 1>()));
+        static_assert(std::is_same<M1, M2>{}, "");
+    }
+
+    // Keys of different types can be mixed, as long as they are Orderable
+    {
+        auto m = hana::make_ordered_map(
+            hana::make_pair(hana::long_c<30>, 'c'),
+            hana::make_pair(hana::int_c<10>, 'a'),
+            hana::make_pair(hana::long_c<20>, 'b')
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(m, [](auto ...x) {
+            return std::string{hana::second(x)...};
+        }) == "abc");
+    }
+
+    // Runtime values are moved into the map
+    {
+        std::string s = "value";
+        auto m = hana::make_ordered_map(
+            hana::make_pair(hana::int_c<1>, std::move(s)),
+            hana::make_pair(hana::int_c<0>, std::string{"zero"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(m[hana::int_c<1>] == "value");
+        BOOST_HANA_RUNTIME_CHECK(m[hana::int_c<0>] == "zero");
+    }
+
+    // Default construction
+    {
+        using M = decltype(hana::make_ordered_map(
+            hana::make_pair(hana::int_c<1>, int{}),
+            hana::make_pair(hana::int_c<0>, int{})
+        ));
+        constexpr M m{};
+        static_assert(m[hana::int_c<0>] == 0, "");
+        static_assert(m[hana::int_c<1>] == 0, "");
+    }
+}
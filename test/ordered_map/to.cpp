@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/ordered_map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+template <int i, int j>
+auto p() { return hana::make_pair(ct_ord<i>{}, ct_eq<j>{}); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_ordered_map(hana::make_tuple()),
+        hana::make_ordered_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_ordered_map(hana::make_tuple(p<2, 2>(), p<0, 0>(), p<1, 1>())),
+        hana::make_ordered_map(p<0, 0>(), p<1, 1>(), p<2, 2>())
+    ));
+
+    // Only the first occurence of duplicate keys is kept
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_ordered_map(hana::make_tuple(p<1, 1>(), p<0, 0>(), p<1, 2>(), p<0, 3>())),
+        hana::make_ordered_map(p<0, 0>(), p<1, 1>())
+    ));
+
+    // Conversions to and from hana::map
+    auto m = hana::make_ordered_map(p<1, 1>(), p<0, 0>());
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_map(m),
+        hana::make_map(p<0, 0>(), p<1, 1>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_ordered_map(hana::make_map(p<1, 1>(), p<0, 0>())),
+        m
+    ));
+}
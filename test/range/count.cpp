@@ -0,0 +1,84 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/count.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<0>), hana::int_c<0>),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<1>), hana::int_c<0>),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<5>), hana::int_c<4>),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<5>), hana::int_c<5>),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::make_range(hana::int_c<-3>, hana::int_c<5>), hana::long_c<-3>),
+        hana::size_c<1>
+    ));
+
+    // with a signed range
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<int, -5, 5>, hana::int_c<3>),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<int, -5, 5>, hana::int_c<-5>),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<int, -5, 5>, hana::int_c<-6>),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<long, -5, 5>, hana::int_c<-1>),
+        hana::size_c<1>
+    ));
+
+    // with a value of a wider type than the range, which must not be
+    // truncated to the type of the range
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<int, -5, 5>, hana::llong_c<-5 - (1LL << 32)>),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<unsigned, 0, 5>, hana::ullong_c<3 + (1ULL << 32)>),
+        hana::size_c<0>
+    ));
+
+    // with unsigned types of mixed widths; mixing signed and unsigned types
+    // is rejected by `hana::equal`, like for any other Foldable
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<unsigned, 0, 5>, hana::size_c<3>),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::count(hana::range_c<std::size_t, 0, 5>, hana::uint_c<5>),
+        hana::size_c<0>
+    ));
+
+    // with a value that is not a compile-time constant
+    BOOST_HANA_RUNTIME_CHECK(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<5>), 3) == 1u
+    );
+    BOOST_HANA_RUNTIME_CHECK(
+        hana::count(hana::make_range(hana::int_c<0>, hana::int_c<5>), 7) == 0u
+    );
+}
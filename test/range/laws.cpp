@@ -30,9 +30,18 @@ int main() {
     );
 
     auto integers = hana::tuple_c<int, 0, 1, 900>;
+    (void)integers;
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestComparable<hana::range_tag>{ranges};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestFoldable<hana::range_tag>{ranges};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestIterable<hana::range_tag>{ranges};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 4
     hana::test::TestSearchable<hana::range_tag>{ranges, integers};
+#endif
 }
@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/flatten.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/runtime_optional.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+hana::runtime_optional<int> half(int x) {
+    if (x % 2 == 0)
+        return x / 2;
+    return {};
+}
+
+int main() {
+    auto inc = [](int x) { return hana::just(x + 1); };
+    auto fail = [](int) { return hana::nothing; };
+    int calls = 0;
+    auto counting_fail = [&](int) { ++calls; return hana::nothing; };
+
+    // runtime_optional -> runtime_optional
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::chain(half(8), half) == hana::make_runtime_optional(2));
+        BOOST_HANA_RUNTIME_CHECK(!hana::chain(half(6), half).has_value());
+        BOOST_HANA_RUNTIME_CHECK(!hana::chain(half(3), half).has_value());
+        BOOST_HANA_RUNTIME_CHECK((half(8) | half | half) == hana::make_runtime_optional(1));
+    }
+
+    // runtime_optional -> hana::optional
+    {
+        auto r = half(8) | inc;
+        static_assert(std::is_same<decltype(r), hana::runtime_optional<int>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(r == hana::make_runtime_optional(5));
+        BOOST_HANA_RUNTIME_CHECK(!(half(3) | inc).has_value());
+
+        // The result is statically known to be nothing, but the function
+        // is still called when there is a value
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(half(8) | fail, hana::nothing));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(half(8) | counting_fail, hana::nothing));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(half(3) | counting_fail, hana::nothing));
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+
+    // hana::optional -> runtime_optional
+    {
+        auto r = hana::just(8) | half;
+        static_assert(std::is_same<decltype(r), hana::runtime_optional<int>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(r == hana::make_runtime_optional(4));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::nothing | half, hana::nothing));
+        BOOST_HANA_RUNTIME_CHECK((hana::just(6) | half | inc | half) == hana::make_runtime_optional(2));
+    }
+
+    // flatten
+    {
+        auto nested = hana::make_runtime_optional(half(4));
+        BOOST_HANA_RUNTIME_CHECK(hana::flatten(nested) == hana::make_runtime_optional(2));
+        BOOST_HANA_RUNTIME_CHECK(!hana::flatten(hana::make_runtime_optional(half(3))).has_value());
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::flatten(hana::make_runtime_optional(hana::just(1))) == hana::make_runtime_optional(1)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::flatten(hana::make_runtime_optional(hana::nothing)), hana::nothing
+        ));
+        BOOST_HANA_RUNTIME_CHECK(hana::flatten(hana::just(half(4))) == hana::make_runtime_optional(2));
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/runtime_optional.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct tracked { };
+using counted = hana::experimental::instrumented<std::string, tracked>;
+
+int main() {
+    // Trivially copyable values keep runtime_optional trivially copyable,
+    // and usable in constant expressions
+    {
+        static_assert(std::is_trivially_copyable<hana::runtime_optional<int>>{}, "");
+        constexpr hana::runtime_optional<int> empty{};
+        constexpr hana::runtime_optional<int> full{3};
+        static_assert(!empty.has_value(), "");
+        static_assert(full.has_value() && *full == 3, "");
+        static_assert(empty.value_or(4) == 4, "");
+        static_assert(full.value_or(4) == 3, "");
+        constexpr hana::runtime_optional<int> copy = full;
+        static_assert(*copy == 3, "");
+    }
+
+    // Construction from hana::optional
+    {
+        hana::runtime_optional<int> from_just = hana::just(3);
+        BOOST_HANA_RUNTIME_CHECK(from_just.has_value() && *from_just == 3);
+
+        hana::runtime_optional<int> from_nothing = hana::nothing;
+        BOOST_HANA_RUNTIME_CHECK(!from_nothing);
+    }
+
+    // Observers
+    {
+        auto opt = hana::make_runtime_optional(std::string{"abc"});
+        static_assert(std::is_same<decltype(opt), hana::runtime_optional<std::string>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(opt.value() == "abc");
+        BOOST_HANA_RUNTIME_CHECK(opt->size() == 3);
+        std::string moved = *std::move(opt);
+        BOOST_HANA_RUNTIME_CHECK(moved == "abc");
+        BOOST_HANA_RUNTIME_CHECK(hana::runtime_optional<std::string>{}.value_or("def") == "def");
+    }
+
+    // Values with non-trivial special members are constructed and
+    // destroyed exactly once, and only when the optional is engaged
+    {
+        auto& counts = hana::experimental::instrumentation<tracked>();
+        {
+            hana::runtime_optional<counted> empty{};
+            hana::runtime_optional<counted> full{counted{"abc"}};
+            hana::runtime_optional<counted> copy = full;
+            hana::runtime_optional<counted> move = std::move(copy);
+            BOOST_HANA_RUNTIME_CHECK(move.has_value() && move->value == "abc");
+
+            empty = full;           // copy-construct into the empty optional
+            full = move;            // copy-assign the values
+            move = hana::runtime_optional<counted>{}; // destroy the value
+            BOOST_HANA_RUNTIME_CHECK(!move.has_value());
+            BOOST_HANA_RUNTIME_CHECK(empty.has_value() && empty->value == "abc");
+        }
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions + counts.copies + counts.moves
+                                 == counts.destructions);
+        BOOST_HANA_RUNTIME_CHECK(counts.copy_assignments == 1);
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/runtime_optional.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto four = hana::make_runtime_optional(4);
+    auto three = hana::make_runtime_optional(3);
+    hana::runtime_optional<int> empty{};
+
+    // Runtime predicates
+    BOOST_HANA_RUNTIME_CHECK(hana::find_if(four, is_even) == four);
+    BOOST_HANA_RUNTIME_CHECK(!hana::find_if(three, is_even).has_value());
+    BOOST_HANA_RUNTIME_CHECK(!hana::find_if(empty, is_even).has_value());
+
+    BOOST_HANA_RUNTIME_CHECK(hana::any_of(four, is_even));
+    BOOST_HANA_RUNTIME_CHECK(!hana::any_of(three, is_even));
+    BOOST_HANA_RUNTIME_CHECK(!hana::any_of(empty, is_even));
+
+    // Compile-time predicates
+    BOOST_HANA_RUNTIME_CHECK(hana::find_if(four, hana::always(hana::true_c)) == four);
+    BOOST_HANA_RUNTIME_CHECK(!hana::find_if(empty, hana::always(hana::true_c)).has_value());
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(four, hana::always(hana::false_c)),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(!hana::any_of(four, hana::always(hana::false_c)));
+}
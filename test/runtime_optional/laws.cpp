@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/runtime_optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/monad.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto ints = hana::make_tuple(
+        hana::runtime_optional<int>{},
+        hana::make_runtime_optional(0),
+        hana::make_runtime_optional(1),
+        hana::make_runtime_optional(2)
+    );
+
+    auto int_values = hana::make_tuple(0, 2, 3);
+
+    auto nested_ints = hana::make_tuple(
+        hana::runtime_optional<hana::runtime_optional<int>>{},
+        hana::make_runtime_optional(hana::make_runtime_optional(0)),
+        hana::make_runtime_optional(hana::runtime_optional<int>{}),
+        hana::make_runtime_optional(hana::make_runtime_optional(2))
+    );
+
+    hana::test::TestComparable<hana::runtime_optional_tag>{ints};
+    hana::test::TestOrderable<hana::runtime_optional_tag>{ints};
+    hana::test::TestMonad<hana::runtime_optional_tag>{ints, nested_ints};
+    hana::test::TestSearchable<hana::runtime_optional_tag>{ints, int_values};
+}
@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ap.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/lift.hpp>
+#include <boost/hana/runtime_optional.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto size = [](std::string const& s) { return s.size(); };
+
+    // transform
+    {
+        auto full = hana::transform(hana::make_runtime_optional(std::string{"abc"}), size);
+        static_assert(std::is_same<decltype(full), hana::runtime_optional<std::size_t>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(full.has_value() && *full == 3);
+
+        auto empty = hana::transform(hana::runtime_optional<std::string>{}, size);
+        BOOST_HANA_RUNTIME_CHECK(!empty.has_value());
+    }
+
+    // lift and ap
+    {
+        auto f = hana::lift<hana::runtime_optional_tag>(size);
+        auto x = hana::lift<hana::runtime_optional_tag>(std::string{"abcd"});
+        BOOST_HANA_RUNTIME_CHECK(hana::ap(f, x) == hana::make_runtime_optional(std::size_t{4}));
+
+        hana::runtime_optional<decltype(size)> no_f{};
+        hana::runtime_optional<std::string> no_x{};
+        BOOST_HANA_RUNTIME_CHECK(!hana::ap(no_f, x).has_value());
+        BOOST_HANA_RUNTIME_CHECK(!hana::ap(f, no_x).has_value());
+        BOOST_HANA_RUNTIME_CHECK(!hana::ap(no_f, no_x).has_value());
+    }
+}
@@ -57,8 +57,16 @@ int main() {
         )
     );
 
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 1
     hana::test::TestFunctor<hana::tuple_tag>{eq_tuples, eq_values};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 2
     hana::test::TestApplicative<hana::tuple_tag>{eq_tuples};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 3
     hana::test::TestMonad<hana::tuple_tag>{eq_tuples, nested_eqs};
+#endif
+#if !defined(BOOST_HANA_TEST_PART) || BOOST_HANA_TEST_PART == 4
     hana::test::TestMonadPlus<hana::tuple_tag>{eq_tuples, predicates, eq_values};
+#endif
 }
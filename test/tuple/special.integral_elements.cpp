@@ -0,0 +1,101 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/count.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/minimum.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+// Sequences of `integral_constant`s of a single type are handled by a
+// constexpr loop over their values; make sure the results have exactly
+// the same type as they would with the generic algorithms.
+template <typename T, typename U>
+void check_same(T, U) {
+    static_assert(std::is_same<T, U>{}, "");
+}
+
+template <int ...i>
+constexpr hana::tuple<hana::int_<i>...> ints{};
+
+int main() {
+    // maximum and minimum
+    {
+        check_same(hana::maximum(ints<0>), hana::int_c<0>);
+        check_same(hana::maximum(ints<3, -1, 4, -1, 5, 9, 2>), hana::int_c<9>);
+        check_same(hana::maximum(ints<-3, -1, -4>), hana::int_c<-1>);
+        check_same(hana::maximum(hana::make_basic_tuple(hana::uint_c<1>, hana::uint_c<2>)),
+                   hana::uint_c<2>);
+        check_same(hana::maximum(hana::make_tuple(hana::false_c, hana::true_c)),
+                   hana::true_c);
+
+        check_same(hana::minimum(ints<0>), hana::int_c<0>);
+        check_same(hana::minimum(ints<3, -1, 4, -1, 5, 9, 2>), hana::int_c<-1>);
+        check_same(hana::minimum(hana::make_basic_tuple(hana::char_c<'b'>, hana::char_c<'a'>)),
+                   hana::char_c<'a'>);
+
+        // elements of different types go through hana::less
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::maximum(hana::make_tuple(hana::int_c<1>, hana::long_c<3>, hana::int_c<2>)),
+            hana::long_c<3>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::minimum(hana::make_tuple(hana::int_c<1>, hana::long_c<0>, hana::int_c<2>)),
+            hana::long_c<0>
+        ));
+    }
+
+    // sort
+    {
+        check_same(hana::sort(ints<0>), ints<0>);
+        check_same(hana::sort(ints<3, -1, 4, -1, 5, 9, 2>), ints<-1, -1, 2, 3, 4, 5, 9>);
+        check_same(hana::sort(ints<1, 2, 3>), ints<1, 2, 3>);
+        check_same(hana::sort(hana::make_basic_tuple(hana::long_c<2>, hana::long_c<1>)),
+                   hana::make_basic_tuple(hana::long_c<1>, hana::long_c<2>));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::make_tuple(hana::int_c<2>, hana::long_c<1>)),
+            hana::make_tuple(hana::long_c<1>, hana::int_c<2>)
+        ));
+    }
+
+    // unique
+    {
+        check_same(hana::unique(ints<0>), ints<0>);
+        check_same(hana::unique(ints<0, 0, 0>), ints<0>);
+        check_same(hana::unique(ints<1, 1, 2, 1, 3, 3>), ints<1, 2, 1, 3>);
+        check_same(hana::unique(hana::make_basic_tuple(hana::char_c<'a'>, hana::char_c<'a'>)),
+                   hana::make_basic_tuple(hana::char_c<'a'>));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::make_tuple(hana::int_c<1>, hana::long_c<1>, hana::int_c<2>)),
+            hana::make_tuple(hana::int_c<1>, hana::int_c<2>)
+        ));
+    }
+
+    // count
+    {
+        check_same(hana::count(ints<0>, hana::int_c<0>), hana::size_c<1>);
+        check_same(hana::count(ints<0>, hana::int_c<1>), hana::size_c<0>);
+        check_same(hana::count(ints<1, 2, 1, 3, 1>, hana::int_c<1>), hana::size_c<3>);
+
+        // the value may be an rvalue or a non-const lvalue
+        check_same(hana::count(ints<1, 2, 1, 3, 1>, hana::int_<1>{}), hana::size_c<3>);
+        auto one = hana::int_c<1>;
+        check_same(hana::count(ints<1, 2, 1, 3, 1>, one), hana::size_c<3>);
+
+        // values of another type are compared with hana::equal
+        check_same(hana::count(ints<1, 2, 1, 3, 1>, hana::long_c<1>), hana::size_c<3>);
+        BOOST_HANA_RUNTIME_CHECK(hana::count(ints<1, 2, 1, 3, 1>, 1) == 3u);
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/back.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/scan_left.hpp>
+#include <boost/hana/scan_right.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <typename T, typename U>
+void check_same(T, U) {
+    static_assert(std::is_same<T, U>{}, "");
+}
+
+// Same as hana::plus, but not recognized by the constexpr loop.
+struct add {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return hana::plus(x, y); }
+};
+
+struct concat {
+    std::string operator()(std::string const& x, std::string const& y) const
+    { return x + y; }
+};
+
+template <int ...i>
+constexpr hana::tuple<hana::int_<i>...> ints{};
+
+struct counted_tag;
+using counted = hana::experimental::instrumented<int, counted_tag>;
+
+struct add_counted {
+    counted operator()(counted const& x, counted const& y) const
+    { return counted{x.value + y.value}; }
+};
+
+int main() {
+    // Prefix and suffix sums of integral constants are computed with a
+    // constexpr loop, but they must be the same as with any other function.
+    {
+        check_same(hana::scan_left(ints<1>, hana::plus), ints<1>);
+        check_same(hana::scan_left(ints<1, 2, 3, -4>, hana::plus), ints<1, 3, 6, 2>);
+        check_same(hana::scan_left(ints<1, 2, 3, -4>, hana::plus),
+                   hana::scan_left(ints<1, 2, 3, -4>, add{}));
+        check_same(hana::scan_left(ints<1, 2, 3>, hana::int_c<10>, hana::plus),
+                   ints<10, 11, 13, 16>);
+        check_same(hana::scan_left(ints<1, 2, 3>, hana::int_c<10>, hana::plus),
+                   hana::scan_left(ints<1, 2, 3>, hana::int_c<10>, add{}));
+
+        check_same(hana::scan_right(ints<1>, hana::plus), ints<1>);
+        check_same(hana::scan_right(ints<1, 2, 3, -4>, hana::plus), ints<2, 1, -1, -4>);
+        check_same(hana::scan_right(ints<1, 2, 3, -4>, hana::plus),
+                   hana::scan_right(ints<1, 2, 3, -4>, add{}));
+        check_same(hana::scan_right(ints<1, 2, 3>, hana::int_c<10>, hana::plus),
+                   ints<16, 15, 13, 10>);
+        check_same(hana::scan_right(ints<1, 2, 3>, hana::int_c<10>, hana::plus),
+                   hana::scan_right(ints<1, 2, 3>, hana::int_c<10>, add{}));
+
+        // with a state of another type
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_left(ints<1, 2>, hana::long_c<10>, hana::plus),
+            hana::make_tuple(hana::long_c<10>, hana::long_c<11>, hana::long_c<13>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_right(ints<1, 2>, hana::long_c<10>, hana::plus),
+            hana::make_tuple(hana::long_c<13>, hana::long_c<12>, hana::long_c<10>)
+        ));
+    }
+
+    // Offsets of fields from their sizes
+    {
+        constexpr auto sizes = hana::make_tuple(hana::size_c<sizeof(char)>,
+                                                hana::size_c<sizeof(int)>,
+                                                hana::size_c<sizeof(double)>);
+        check_same(hana::scan_left(sizes, hana::size_c<0>, hana::plus),
+                   hana::make_tuple(hana::size_c<0>,
+                                    hana::size_c<sizeof(char)>,
+                                    hana::size_c<sizeof(char) + sizeof(int)>,
+                                    hana::size_c<sizeof(char) + sizeof(int) + sizeof(double)>));
+    }
+
+    // The depth of the recursion does not grow with the number of elements
+    {
+        auto xs = hana::unpack(hana::range_c<int, 0, 100>, hana::make_tuple);
+        auto left = hana::scan_left(xs, add{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::back(left), hana::int_c<99 * 100 / 2>));
+        auto right = hana::scan_right(xs, hana::int_c<0>, add{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::front(right), hana::int_c<99 * 100 / 2>));
+    }
+
+    // Each state is moved once, into the result, and the elements of an
+    // rvalue sequence are not copied.
+    {
+        auto xs = hana::make_tuple(counted{1}, counted{2}, counted{3},
+                                   counted{4}, counted{5}, counted{6});
+        auto counts = hana::experimental::count_operations<counted_tag>([&] {
+            return hana::scan_left(std::move(xs), add_counted{});
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 6);
+    }
+    {
+        auto xs = hana::make_tuple(counted{1}, counted{2}, counted{3},
+                                   counted{4}, counted{5}, counted{6});
+        auto counts = hana::experimental::count_operations<counted_tag>([&] {
+            return hana::scan_right(std::move(xs), counted{0}, add_counted{});
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 7);
+    }
+
+    // With runtime values
+    {
+        auto xs = hana::make_tuple(std::string{"a"}, std::string{"b"}, std::string{"c"});
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::scan_left(xs, concat{}) == hana::make_tuple(
+                std::string{"a"}, std::string{"ab"}, std::string{"abc"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::scan_right(xs, std::string{"!"}, concat{}) == hana::make_tuple(
+                std::string{"abc!"}, std::string{"bc!"}, std::string{"c!"}, std::string{"!"})
+        );
+    }
+}
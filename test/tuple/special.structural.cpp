@@ -0,0 +1,104 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/insert_range.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/prepend.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/remove_range.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/take_back.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+// This test checks that the structural algorithms on tuples build their
+// result in a single pass, moving from rvalue tuples and copying from
+// lvalue tuples.
+
+struct Counted {
+    static int copies;
+    static int moves;
+    Counted() = default;
+    Counted(Counted const&) { ++copies; }
+    Counted(Counted&&) { ++moves; }
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+template <typename F>
+void check(F f, int copies, int moves) {
+    auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{}, Counted{});
+    Counted::copies = Counted::moves = 0;
+    auto result = f(xs);
+    (void)result;
+    BOOST_HANA_RUNTIME_CHECK(Counted::copies == copies);
+    BOOST_HANA_RUNTIME_CHECK(Counted::moves == moves);
+}
+
+int main() {
+    auto xs = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+
+    // Results
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::append(xs, ct_eq<3>{}),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::prepend(xs, ct_eq<3>{}),
+        hana::make_tuple(ct_eq<3>{}, ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(xs, hana::make_tuple(ct_eq<3>{})),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(hana::make_tuple(), hana::make_tuple()),
+        hana::make_tuple()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(xs, hana::size_c<10>, ct_eq<3>{}),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert_range(xs, hana::size_c<1>,
+                           hana::make_basic_tuple(ct_eq<3>{}, ct_eq<4>{})),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<3>{}, ct_eq<4>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice(xs, hana::make_tuple(hana::size_c<2>, hana::size_c<0>, hana::size_c<2>)),
+        hana::make_tuple(ct_eq<2>{}, ct_eq<0>{}, ct_eq<2>{})
+    ));
+
+    // Moves and copies
+    check([](auto& xs) { return hana::append(std::move(xs), Counted{}); }, 0, 5);
+    check([](auto& xs) { return hana::append(xs, Counted{}); }, 4, 1);
+    check([](auto& xs) { return hana::prepend(std::move(xs), Counted{}); }, 0, 5);
+    check([](auto& xs) { return hana::concat(std::move(xs), hana::make_tuple(Counted{})); }, 0, 6);
+    check([](auto& xs) { return hana::insert(std::move(xs), hana::size_c<2>, Counted{}); }, 0, 5);
+    check([](auto& xs) {
+        return hana::insert_range(std::move(xs), hana::size_c<2>, hana::make_tuple(Counted{}));
+    }, 0, 6);
+    check([](auto& xs) { return hana::remove_at(std::move(xs), hana::size_c<1>); }, 0, 3);
+    check([](auto& xs) { return hana::remove_range(std::move(xs), hana::size_c<1>, hana::size_c<3>); }, 0, 2);
+    check([](auto& xs) { return hana::slice(std::move(xs), hana::range_c<std::size_t, 1, 3>); }, 0, 2);
+    check([](auto& xs) { return hana::reverse(std::move(xs)); }, 0, 4);
+    check([](auto& xs) { return hana::reverse(xs); }, 4, 0);
+    check([](auto& xs) { return hana::take_back(std::move(xs), hana::size_c<3>); }, 0, 3);
+    check([](auto& xs) { return hana::drop_back(std::move(xs), hana::size_c<3>); }, 0, 1);
+}
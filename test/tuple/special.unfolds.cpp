@@ -0,0 +1,125 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unfold_left.hpp>
+#include <boost/hana/unfold_right.hpp>
+
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <typename T, typename U>
+void check_same(T, U) {
+    static_assert(std::is_same<T, U>{}, "");
+}
+
+template <int n>
+struct count_up_to {
+    template <typename I>
+    constexpr auto operator()(I i) const {
+        return hana::if_(i < hana::int_c<n>,
+            hana::just(hana::make_pair(i, i + hana::int_c<1>)),
+            hana::nothing
+        );
+    }
+};
+
+template <int n>
+struct count_down_from {
+    template <typename I>
+    constexpr auto operator()(I i) const {
+        return hana::if_(i < hana::int_c<n>,
+            hana::just(hana::make_pair(i + hana::int_c<1>, i)),
+            hana::nothing
+        );
+    }
+};
+
+struct counted_tag;
+using counted = hana::experimental::instrumented<int, counted_tag>;
+
+template <int n>
+struct count_up_to_counted {
+    template <typename I>
+    auto operator()(I i) const {
+        return hana::if_(i < hana::int_c<n>,
+            hana::just(hana::make_pair(counted{I::value}, i + hana::int_c<1>)),
+            hana::nothing
+        );
+    }
+};
+
+int main() {
+    // Generating many elements does not require a recursion whose depth
+    // is the number of elements.
+    {
+        auto expected = hana::to_tuple(hana::range_c<int, 0, 200>);
+        check_same(
+            hana::unfold_right<hana::tuple_tag>(hana::int_c<0>, count_up_to<200>{}),
+            expected
+        );
+        check_same(
+            hana::unfold_left<hana::tuple_tag>(hana::int_c<0>, count_down_from<200>{}),
+            hana::reverse(expected)
+        );
+    }
+
+    // The number of elements is not a multiple of the number of steps
+    // performed at once.
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unfold_right<hana::tuple_tag>(hana::int_c<0>, count_up_to<17>{}),
+            hana::to_tuple(hana::range_c<int, 0, 17>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unfold_left<hana::tuple_tag>(hana::int_c<0>, count_down_from<16>{}),
+            hana::reverse(hana::to_tuple(hana::range_c<int, 0, 16>))
+        ));
+    }
+
+    // Each element is moved a constant number of times, whatever the
+    // number of elements; building the result one element at a time would
+    // move each element once per element produced after it.
+    {
+        auto counts = hana::experimental::count_operations<counted_tag>([] {
+            return hana::unfold_right<hana::tuple_tag>(hana::int_c<0>,
+                                                       count_up_to_counted<32>{});
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves <= 32 * 6);
+    }
+
+    // With runtime elements
+    {
+        auto f = [](auto state) {
+            auto i = hana::first(state);
+            std::string s = hana::second(state);
+            return hana::if_(i < hana::int_c<3>,
+                hana::just(hana::make_pair(s, hana::make_pair(i + hana::int_c<1>, s + "a"))),
+                hana::nothing
+            );
+        };
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::unfold_right<hana::tuple_tag>(
+                hana::make_pair(hana::int_c<0>, std::string{}), f
+            ) == hana::make_tuple(std::string{""}, std::string{"a"}, std::string{"aa"})
+        );
+    }
+}
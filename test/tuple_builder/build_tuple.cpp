@@ -0,0 +1,82 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+#include <laws/base.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+using hana::test::ct_eq;
+
+
+struct moved_tag;
+using moved = instrumented<int, moved_tag>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::build_tuple(hana::make_tuple(), hana::push_back),
+        hana::make_tuple()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::build_tuple(hana::make_tuple(ct_eq<0>{}), hana::push_back),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::build_tuple(hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}),
+                          hana::push_back),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::build_tuple(hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{},
+                                           ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{},
+                                           ct_eq<6>{}, ct_eq<7>{}, ct_eq<8>{}),
+                          hana::push_back),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{},
+                         ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{}, ct_eq<8>{})
+    ));
+
+    // The function may skip elements by returning the builder it is given
+    {
+        auto skip_1 = [](auto&& builder, auto const& x) {
+            return hana::if_(hana::equal(x, ct_eq<1>{}),
+                builder,
+                hana::push_back(builder, x)
+            );
+        };
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::build_tuple(hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{},
+                                               ct_eq<1>{}, ct_eq<3>{}, ct_eq<4>{}),
+                              skip_1),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+        ));
+    }
+
+    // The elements of an rvalue structure are moved exactly once
+    {
+        auto xs = hana::make_tuple(moved{0}, moved{1}, moved{2}, moved{3},
+                                   moved{4}, moved{5}, moved{6});
+        auto counts = hana::experimental::count_operations<moved_tag>([&] {
+            return hana::build_tuple(std::move(xs), hana::push_back);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 7);
+    }
+
+    // build_tuple is usable in constant expressions
+    {
+        constexpr auto xs = hana::make_tuple(1, '2', 3.0);
+        constexpr auto ys = hana::build_tuple(xs, hana::push_back);
+        static_assert(hana::at_c<0>(ys) == 1, "");
+        static_assert(hana::at_c<1>(ys) == '2', "");
+        static_assert(hana::at_c<2>(ys) == 3.0, "");
+    }
+}
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+#include <laws/base.hpp>
+#include <laws/foldable.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    // Builders refer to the previous builders and to their elements, so
+    // all of them are kept alive while the laws are checked.
+    ct_eq<0> x0{}; ct_eq<1> x1{}; ct_eq<2> x2{}; ct_eq<3> x3{};
+    auto b0 = hana::make_tuple_builder();
+    auto b1 = hana::push_back(b0, x0);
+    auto b2 = hana::push_back(b1, x1);
+    auto b3 = hana::push_back(b2, x2);
+    auto b4 = hana::push_back(b3, x3);
+
+    auto eqs = hana::make_tuple(b0, b1, b2, b3, b4);
+
+    hana::test::TestFoldable<hana::tuple_builder_tag>{eqs};
+}
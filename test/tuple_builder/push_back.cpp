@@ -0,0 +1,88 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+#include <laws/base.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto empty = hana::make_tuple_builder();
+    static_assert(std::is_same<decltype(empty), hana::tuple_builder<>>{}, "");
+    BOOST_HANA_CONSTANT_CHECK(hana::length(empty) == hana::size_c<0>);
+
+    ct_eq<0> x0{}; ct_eq<1> x1{}; ct_eq<2> x2{};
+
+    auto b1 = hana::push_back(empty, x0);
+    BOOST_HANA_CONSTANT_CHECK(hana::length(b1) == hana::size_c<1>);
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(b1),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+
+    auto b2 = hana::push_back(b1, x1);
+    auto b3 = hana::push_back(b2, x2);
+    BOOST_HANA_CONSTANT_CHECK(hana::length(b3) == hana::size_c<3>);
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(b3),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+
+    // The builder being pushed to is left untouched
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(b1),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+
+    // Elements are referred to, and copied when the builder is converted
+    {
+        int i = 1;
+        int const& ref = i;
+        auto b = hana::push_back(empty, ref);
+        i = 2;
+        static_assert(std::is_same<
+            decltype(hana::to_tuple(b)), hana::tuple<int>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(hana::to_tuple(b)) == 2);
+    }
+
+    // Several elements of the same empty type
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::push_back(hana::push_back(hana::push_back(
+                hana::make_tuple_builder(), x0), x0), x0)),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<0>{}, ct_eq<0>{})
+        ));
+    }
+
+    // More elements than what is unpacked at once
+    {
+        auto pushed = [](auto const& b) {
+            return hana::to_tuple(hana::push_back(hana::push_back(hana::push_back(
+                hana::push_back(hana::push_back(hana::push_back(b, 3), 4), 5), 6), 7), 8));
+        };
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            pushed(b3),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, 3, 4, 5, 6, 7, 8)
+        ));
+    }
+
+    // push_back is usable in constant expressions
+    {
+        static_assert(hana::at_c<0>(hana::to_tuple(hana::push_back(
+            hana::push_back(hana::make_tuple_builder(), 1), '2'))) == 1, "");
+        static_assert(hana::at_c<1>(hana::to_tuple(hana::push_back(
+            hana::push_back(hana::make_tuple_builder(), 1), '2'))) == '2', "");
+    }
+}
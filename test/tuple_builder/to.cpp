@@ -0,0 +1,85 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/instrumented.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/tuple_builder.hpp>
+
+#include <laws/base.hpp>
+
+#include <memory>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::instrumented;
+using hana::test::ct_eq;
+
+
+struct rvalues;
+using moved = instrumented<int, rvalues>;
+
+struct lvalues;
+using copied = instrumented<int, lvalues>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::tuple_tag>(hana::make_tuple_builder()),
+        hana::make_tuple()
+    ));
+
+    // Conversion to other sequences goes through Foldable
+    {
+        ct_eq<0> x0{}; ct_eq<1> x1{};
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to<hana::basic_tuple_tag>(hana::push_back(
+                hana::push_back(hana::make_tuple_builder(), x0), x1)),
+            hana::make_basic_tuple(ct_eq<0>{}, ct_eq<1>{})
+        ));
+    }
+
+    // Move-only elements pushed as rvalues are moved into the tuple
+    {
+        auto t = hana::to_tuple(hana::push_back(
+            hana::push_back(hana::make_tuple_builder(), std::make_unique<int>(1)),
+            std::make_unique<int>(2)
+        ));
+        static_assert(std::is_same<decltype(t),
+            hana::tuple<std::unique_ptr<int>, std::unique_ptr<int>>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<0>(t) == 1);
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<1>(t) == 2);
+    }
+
+    // Each element is moved exactly once, when the tuple is created, however
+    // many elements are pushed before it.
+    {
+        auto counts = hana::experimental::count_operations<rvalues>([] {
+            return hana::to_tuple(
+                hana::push_back(hana::push_back(hana::push_back(hana::push_back(
+                hana::push_back(hana::push_back(hana::push_back(hana::push_back(
+                    hana::make_tuple_builder(),
+                    moved{0}), moved{1}), moved{2}), moved{3}),
+                    moved{4}), moved{5}), moved{6}), moved{7})
+            );
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.constructions == 8);
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 8);
+    }
+
+    // Elements pushed as lvalues are copied exactly once
+    {
+        auto xs = hana::make_tuple(copied{0}, copied{1}, copied{2},
+                                   copied{3}, copied{4});
+        auto counts = hana::experimental::count_operations<lvalues>([&] {
+            return hana::build_tuple(xs, hana::push_back);
+        });
+        BOOST_HANA_RUNTIME_CHECK(counts.copies == 5);
+        BOOST_HANA_RUNTIME_CHECK(counts.moves == 0);
+    }
+}
@@ -0,0 +1,88 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/unroll.hpp>
+
+#include <cstddef>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct record {
+    std::vector<std::size_t>& indices;
+    std::vector<std::size_t>& offsets;
+
+    template <std::size_t k>
+    void operator()(std::size_t i, hana::size_t<k>) const {
+        indices.push_back(i);
+        offsets.push_back(k);
+    }
+};
+
+template <std::size_t N, std::size_t Block, std::size_t Stride>
+void check(std::vector<std::size_t> expected_indices,
+           std::vector<std::size_t> expected_offsets)
+{
+    std::vector<std::size_t> indices, offsets;
+    hana::unroll<N, Block>(hana::size_c<Stride>, record{indices, offsets});
+    BOOST_HANA_RUNTIME_CHECK(indices == expected_indices);
+    BOOST_HANA_RUNTIME_CHECK(offsets == expected_offsets);
+}
+
+struct accumulate {
+    std::size_t* sum;
+
+    template <std::size_t k>
+    constexpr void operator()(std::size_t i, hana::size_t<k>) const
+    { *sum += i * 10 + k; }
+};
+
+template <std::size_t N, std::size_t Block, std::size_t Stride>
+constexpr std::size_t constexpr_sum() {
+    std::size_t sum = 0;
+    hana::unroll<N, Block>(hana::size_c<Stride>, accumulate{&sum});
+    return sum;
+}
+
+int main() {
+    // fully unrolled
+    check<0, 1, 1>({}, {});
+    check<1, 1, 1>({0}, {0});
+    check<4, 4, 1>({0, 1, 2, 3}, {0, 1, 2, 3});
+    {
+        std::vector<std::size_t> indices, offsets;
+        hana::unroll<0>(record{indices, offsets});
+        BOOST_HANA_RUNTIME_CHECK(indices.empty());
+        hana::unroll<3>(record{indices, offsets});
+        BOOST_HANA_RUNTIME_CHECK(indices == std::vector<std::size_t>{0, 1, 2});
+        BOOST_HANA_RUNTIME_CHECK(offsets == std::vector<std::size_t>{0, 1, 2});
+    }
+
+    // blocks, with and without a partial block at the end
+    check<6, 2, 1>({0, 1, 2, 3, 4, 5}, {0, 1, 0, 1, 0, 1});
+    check<7, 3, 1>({0, 1, 2, 3, 4, 5, 6}, {0, 1, 2, 0, 1, 2, 0});
+    check<2, 8, 1>({0, 1}, {0, 1});
+
+    // strides
+    check<6, 6, 2>({0, 2, 4}, {0, 2, 4});
+    check<7, 7, 2>({0, 2, 4, 6}, {0, 2, 4, 6});
+    check<10, 2, 3>({0, 3, 6, 9}, {0, 3, 0, 3});
+    check<11, 3, 2>({0, 2, 4, 6, 8, 10}, {0, 2, 4, 0, 2, 4});
+    check<3, 1, 5>({0}, {0});
+
+    // in constant expressions
+    static_assert(constexpr_sum<0, 1, 1>() == 0, "");
+    static_assert(constexpr_sum<4, 4, 1>() == 60 + 6, "");
+    static_assert(constexpr_sum<5, 2, 1>() == 100 + (0 + 1 + 0 + 1 + 0), "");
+    static_assert(constexpr_sum<7, 2, 3>() == 90 + (0 + 3 + 0), "");
+
+    // a large number of iterations
+    {
+        std::size_t sum = 0;
+        hana::unroll<1000, 16>([&](std::size_t i, auto) { sum += i; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 999 * 1000 / 2);
+    }
+}